@@ -0,0 +1,1767 @@
+#define INPUT_LAYER 64
+#define HIDDEN1 16
+#define HIDDEN2 8
+#define QUANTIZE 64
+#define NNUE_CRELU 1
+#define L1_QUANTIZE 127
+
+uint32_t thresholds[] = {13,28,59,117,176,198,217,205,20,7,7,15,1,25,94,255};
+uint8_t compressed_data[] = {
+	 63,172,144, 47, 66, 93, 65, 13,199,221,165,128,231,243,145,207,253,246,135,198,
+	167,210, 21,159,122,189, 46,116, 22,145,  9,  4,239,117,253, 64, 29,152,112, 51,
+	 60, 78, 80,164, 22, 64,135,137, 96,  5,180,110, 86,100, 21,  4, 72, 46, 44,159,
+	216,244,167,210,244, 69,217,147, 83, 41, 55,  0,216,163, 19, 74,249,234,182,117,
+	  1,226, 84, 96, 93, 69,200, 51, 29, 97,206, 14,158, 69,166, 98,236, 70,232,134,
+	 37,222,212,179, 97,  5,102,196, 82, 80,234,194, 59, 77,160, 80, 61, 26,145,152,
+	 91, 12,196,244, 70, 28, 22,238, 99, 72, 73,251,167, 67,199, 74, 94,233, 56,204,
+	 26,  1,158,100, 31,189, 36,224,179,106,100, 95,181, 50,152, 90,215,246,137, 26,
+	212,117, 81,164,133,134,169,206,156, 41,236,128,228, 49,241, 21,175,118,126, 24,
+	142, 78,171,178, 77, 95, 30, 28,  7,226,172, 21,199,200,121, 98,136,  9,161,175,
+	 87, 72,153,240, 44, 22,166, 51,153,235,114,193,210,228, 84,214,140,225,192, 73,
+	154,144,131,125,218, 26, 56, 33, 62,144, 24,194, 33, 82,207,172, 43,226,  8,243,
+	255,121,167, 23,182,126,159,166, 34,184, 86,207,183,252, 99, 55, 10,191,141, 27,
+	 97,251,186,170,249,120,202,  5,  7,113,198,131,140,224,193,135,141,106,238,227,
+	 90, 88,149,177,162, 44,167,128, 87, 76,112,130, 46,168,159, 51,196,158,  9, 20,
+	 75,  6,122,167, 94, 36,180,171, 99,250,221,  7, 51,202,202, 62,221,189, 53,140,
+	  8, 67,250,167,117, 66, 13,  7,226,222, 16,216,181,151,105,233,190,186, 51, 87,
+	109,137, 51,135,250,239,130,158,166,138,216,238,170,  8, 69,130, 70,142, 61, 99,
+	181,176,226,254,140, 38,113, 42,139, 82,121,243,160,205,157, 10,163, 62, 73, 90,
+	 56, 68,204,217,208, 99,228,147,245,226,110, 21, 40,148,111,146,131, 82,149,  7,
+	 99, 55,227,203,  5, 24,127,225,149,231,204,142, 20,120,163,252,153,171,225,178,
+	207, 30,143,178, 99, 67,252,156, 37, 29,198,102, 56,134, 81,210,175, 97, 75, 87,
+	 48,244, 40,202,  1,153, 78,248, 94,237, 98,216,250, 74,221,162,205,184,180,123,
+	100,151, 40,143,211,212, 58,122, 16,127, 14,  2, 39,236, 69, 30, 44,168,254, 36,
+	 81, 31,130,186, 84,226,231,209, 17,169,101, 50,170, 34,203, 35, 40, 96,218, 82,
+	  3,253,160, 57, 72, 39,135,144,237, 66, 66, 31,120, 86, 13,  8,138,190,198,118,
+	 30,196,112,225, 30, 63,253,128, 92, 72, 48,211, 39, 81,165, 80,183,213,177,222,
+	 24,203,214, 92, 39,131, 77, 33, 67, 75, 85,192, 93, 24,133, 74, 39, 39,242,101,
+	 14, 74,248,221, 29,138, 90,134, 59,226,166,181, 20,131,209,152,155, 60,181,222,
+	155,134, 49,252, 47,181,202,195, 27,106,185, 38, 23,171,239, 57,  6, 63,169,167,
+	 52,184, 43,213,160,168, 21,126, 60,244,100,204,194, 81,228, 12,175, 62, 57, 50,
+	106,160,232,201,144,150,127, 46,227, 27,217, 45,111, 47,159, 94,125,228,162, 18,
+	102, 10, 86, 50,187,116,248, 62,172,125, 87,112,223,129,143, 35, 80,251, 57,120,
+	225, 39,236,113,231, 48, 65,110,189,171, 25,142,126,135,156,190,  8,199,156,127,
+	142,213,207, 65,139,190, 68,104,132, 61,158, 75,158,149,137,140,148,185,227,186,
+	158,145,124, 59,141,180,183,101, 19,104,187,203,142,101,244,118,212, 30, 52,217,
+	 18,228, 67,155,115, 99,205,206, 12,118, 89, 75, 74,  0,155,219,230, 45,141,207,
+	 54, 39,197, 74, 27,238,182,  9,185, 83,247,124,114,253,168,158,  8,225, 28,115,
+	 32, 67,108,127,217,103, 34,105,204,152, 63,192, 85, 73,233,248, 82,156,163, 46,
+	159,120, 90,220,216,103,  0,251,  8,249,109, 28, 25,190,  2,107, 88, 37,164, 75,
+	 41,202,235, 10,140,156,100,149, 98,254,128,176,  5, 37, 26,254,184,129, 45, 96,
+	247,  0, 18,  7,167,106, 32, 77, 26,253,137, 35,127, 18, 32, 55,229,174, 91,232,
+	185,181,142,238, 26,244, 13,110,242,196, 63,255,112, 66,156, 76,221,165,152,249,
+	176, 38,139, 27,255,150,130, 17,209, 87,239,108,121,213, 83,215,247, 78, 91,218,
+	 42, 47,231,215,102,196,159, 36, 64,125, 78, 18,158, 58,  9, 51, 22, 56, 56,163,
+	120, 79,224, 86,125, 27,249, 58,144,181,137,229, 65, 88,206,110,184,154, 15, 65,
+	 52, 96,242, 66,  2, 30,235, 43, 92,138,166,163, 52, 48,168,203, 53, 87, 93,186,
+	 38,197,232,223, 54,215, 78, 45, 46,216,151, 59,240,  5, 26,240,118,  0,246, 60,
+	167,226,240,172, 62,104, 62,229, 77, 75,225, 26,224,147,234, 91, 26,226, 97,223,
+	173, 80, 38, 23,101,193, 32, 58, 29,200, 49, 92,227,169,235,102,176,137, 27, 77,
+	189,187,190,114, 20,100,231, 93,213,203,142, 72,223,111,252, 43,243,245, 33,155,
+	113,129,110, 76,218,213, 84,190,124, 48, 45, 81,118,126,226,176,238, 39,238, 37,
+	129,238,174,191,150,  3,103, 18,179,227, 51, 47, 91, 46,139,135,  0,211, 64, 50,
+	188, 51, 41,205, 53,166,135, 50,228,140,232,179, 83,179, 12,165, 16,180, 65,208,
+	211, 40,219,  3,135, 57, 12, 76,240,251,237, 69,182,138, 88, 79, 13,120,205,119,
+	148, 74, 57,204,140,104, 64,184,245,120, 23,187, 38, 25, 49, 90, 64, 48,119,246,
+	 61,232, 98,170, 32, 98, 70, 31, 60, 85,116,147,136,247, 73, 83,190, 50, 10,175,
+	 92,151,196,223,148, 95,132,137,206,143,152,201,204,243, 62,230,250, 12,116, 74,
+	 43,157,169, 99,180,116,227,122, 41, 68, 63,185, 40, 74,210,134,189,150, 44,187,
+	100, 69, 30, 15, 69,187, 58,111, 85, 82,208, 33, 34, 37,119,218, 11,156, 55,241,
+	 53,225, 59,100,186, 93, 24,115, 21, 14,130, 41,118, 70,152,251,154, 83,173,176,
+	  6,208,203, 70, 57, 78,204,244, 61,101,235,193,186, 86, 18, 21,245, 83, 92,210,
+	219, 96, 61, 53,108,243,178,179,233,137,180,215,145,178,173,184, 21,195,158,203,
+	 60,187,216, 32, 51, 24, 53,158,177,  4, 27,251,103, 71,243, 72,177, 47, 19, 36,
+	228,177,115,213, 18,116,251, 60, 92,169,112,216, 81, 24,251,223,243,100, 18, 26,
+	145,213, 39,206,252, 38,192, 70,  9,196, 58, 46,232, 19,243,181,178,233,122, 26,
+	117,202, 52,  4,228,140, 26, 45,161,213,178,122, 81,148, 86,210, 98, 83,181,187,
+	 55,144, 42,200,130,234,181,208, 24,190, 86, 81, 32,141, 80,172, 36,113,176,169,
+	 41, 13, 58,201, 40,197,108, 55,152, 86, 88,210,211,147,240,148, 67,156,199,180,
+	 89,  1,146,254,253,221, 53,134,161,242,164, 67, 91,162, 89,128,240, 77,231, 20,
+	127, 84,161,182, 15, 63, 58,201,235,150, 88,227, 77,139,171,128,122,220,203, 59,
+	250,186,227,228, 63, 61,  6,121, 52, 92,190,115,167, 90,241,219,166, 52, 71, 19,
+	 76, 84,117,254,108,104,195,  5,137, 43, 49,187, 18,250, 74,130, 32,220,101,130,
+	 63, 12,253,243,145,173, 90, 98,202,119,253,  7,227, 11, 76,  8,  8, 74, 84, 17,
+	188, 42,140,147,181,198, 37,196, 51,147,129,176,102,216,190, 75,167,213,255, 90,
+	 72, 11,165,236, 57,  4,186,203, 82, 75,185,129,150,233,145,183,194,170,157,241,
+	 48, 66,242,216,153, 47,125,249,185,  7,105,182,184,223,220, 93,112,250, 59,152,
+	 39,242,149, 56, 85, 56, 19, 21,195, 56,243,108,184, 14,237,125,244, 81, 96, 25,
+	  2,123, 59, 76, 73,189,207, 35, 12,143,143,188, 53,180, 38,224, 24,238,250,103,
+	126,149,236,217,248,186, 42,144, 76,187,199,200,202,175,173,157,167,203,247,190,
+	216,238,249, 41, 44,215,117, 27,243,133,167,181,245, 68, 53,159, 11,223,209,212,
+	195,166,164,160,183,136,236,160,134,122,228, 13,116,133,226,146,221,198,227, 70,
+	 20, 21,166,118,244,159, 77, 42,179,249,224,187,161,  0, 45, 99,167,234,125, 88,
+	 22, 80,162,162,144,170, 74,  7,174,  0,241,135, 20,229, 56,131,132,201,182,241,
+	 69, 74,212, 87,151,194,109, 61,202, 10,138,106, 12,204,119,190,170, 74,229, 63,
+	185,147, 49, 24,245,143,139, 39, 15, 51,137,182,132,215, 27,128, 17,144,241,211,
+	135,253,162,145,190,139,217, 90,168,112,198, 36,103,210,191,240, 20, 29,121,130,
+	 32,116, 98, 91, 68, 32,255, 63, 46, 58,227,168,134,144, 51,255,219,243, 59, 36,
+	108,236,233,  1, 53,154,201, 65, 29, 88, 91,245,114,134,207,166, 98,203,224,183,
+	148,251,249,231, 91,193, 57,122, 42, 51,158, 38,224,107,234, 15,161, 40,222, 71,
+	 46,199,163,  3, 18,232,114,119, 14,199,217,219,  8,223,153, 35, 77,125,208,166,
+	116, 57, 75, 41,156,159, 77,227, 65,144, 87,139, 34,198,  7,248,150,129, 36, 24,
+	  7, 46, 61,195, 52, 21,117, 69,244, 97,118,  5,149, 18, 44,104, 34, 96,170,197,
+	220,  2,103, 83,203, 32, 37, 56, 67,170,244,169,197,156,159,200, 73,234,228,225,
+	237, 81,243,149,180,212,110,111,129,168, 66,158,252,166, 42, 95, 64,242,241, 66,
+	 48,112,170,156,236, 79,235,150, 84,239,134,202, 30,229,122,168,  5,186,135,122,
+	  8, 41,179, 80,163,195,121, 90, 35,112, 94,156,244,121,127,109, 67, 29,152, 82,
+	  3,174,213,207,211,101,218, 35,171, 81,238,234,221, 10,111,160, 17, 51,165,242,
+	 72,103,187,174, 65,168,254, 54,146,245,147, 31,239,  0, 45, 48,191, 90, 63, 34,
+	171,164,250,245,202,182,170,114,187,114,248,158,232,  2,242, 10,177, 72,  7, 68,
+	193,168,211, 12, 66,248, 91, 46,226,251,105,228,216,238,108,238,254,238, 81,207,
+	 11,155,155,109, 63, 89,  7, 41,206,115,137,247,146,226, 92,192,128, 98, 93,152,
+	173,105, 84, 35,175,139, 57, 48,111, 73,237,254,120, 31,187,171, 51,124, 81,176,
+	 31,143,166, 84,  7,131, 25, 57, 93,185,207,208,190,152,100,124,  8,213,199,246,
+	 51,184,  3,171, 71,146, 46,232,106,148,228,105,154,255,100,122,190,113,  6,180,
+	 58, 39,135, 38,241,121, 85,160,253,248, 18,  4, 78,229,170,246,184,147,219,148,
+	 57, 13,127,120, 96, 96,235,228,220,101,105,158,242,  8, 35, 38,203,218,185, 10,
+	200,218,171,186,118,238,100,  0,182,249, 53,164,134,178, 42,198,159,203, 77,110,
+	234,190, 50,175,254,138, 16,169,217, 40,240,152,255, 69,165,244, 77,135,  8,220,
+	  2,242,244, 45, 80,105, 98,232, 76, 14, 51,101,201, 49,166, 73, 15,196,130,127,
+	140, 86,197,219,254,223, 40, 46, 66,147,212, 14, 46, 58, 20,191,121,157,139,159,
+	158, 89, 50,  7,203,138, 81,172, 84, 18,102, 77,160, 35, 48, 98, 94, 93, 59, 11,
+	113,165, 43, 56,133,250,216,181,190, 41,190, 12,252,192, 14,155, 53, 51,112,  4,
+	213, 26,248, 40,125,147,233, 24,240,186, 47,153,113,152,166,251,237, 50,150, 46,
+	217, 66,170,115,142,244,203,157,101, 38,247,122,173,182,223,242,126, 72, 95,249,
+	223,234, 44, 11,200, 92,  7, 74,124, 83, 34, 23,159, 36,197,115,239,146, 89, 58,
+	196,246,116,192,214,  0,221, 72,  0, 31,189,195,113,236, 19, 69,142,124,195,145,
+	130, 74, 51,179,151,125,153,139, 66,135, 62, 20, 95,134,138,227, 17,154,248,165,
+	227, 43,229,136,107,  7,186,163, 85,210,255,146, 68,222,161,142,241,228,199,114,
+	102,208, 48,209,109,184,111,221, 73, 92,107,201,124, 86,121,141, 34, 32, 32, 45,
+	100,191,116, 98, 51,255,113,183, 46,168, 75, 77, 80, 50,185, 82, 40,  3,123,110,
+	144,110,  5,142, 57,126, 25, 72,249, 68, 96,212,183,249, 98,192,220,252,116,150,
+	 81,199,142,119,137,228, 91, 37,143,121,153,221, 34, 78,198, 50,166,148,216, 26,
+	 28,107, 83,181, 57,162,106,248, 52,102, 55, 27, 72, 41, 70,101,251,192,129, 20,
+	206, 86,125, 13,220,162,131, 75,255, 52,189,171, 20, 15,237,  9, 66,  8,183,182,
+	192,249, 23, 30,189,238,112,242,146, 42,251,154, 37,196,254,244, 85,145, 58,137,
+	124,111, 60, 52,202,155, 92,203,186, 84,138,189,171,184, 52, 61,232, 47,190,152,
+	222,109,185,188,210, 66, 70,232, 38, 47,156,198, 89,250,213,242,206, 18,  5, 70,
+	 70,176, 65,193,105, 28, 68,132, 50, 53,159, 13, 59, 38,169,  2,178, 39,182,178,
+	199, 35,116,194, 90,134,142,172, 47,141,220,252, 62,229, 95, 26,171,196,150, 73,
+	225,144, 31,146,137, 56,241,247, 75, 15,164,176, 32,122, 69,165,134, 54, 35, 99,
+	 99, 76,149, 95,104,  3,169,212,208, 55, 45,228, 92,152,152,217,239, 95,130,175,
+	123,242, 11,242,167,164,222, 74, 73,196,130,208,228,124, 99,193,253, 40,128,119,
+	252, 39,137,234,237,167,103,131,101, 96,231, 85,  3,214,197,221,183,119,126, 43,
+	164,215, 31,148, 29, 30,  1,128,208,119,148, 87,181, 21,177, 37,241,189,240,  1,
+	211, 31,235,216,223,203, 20,124,115,139,146,254,249, 64,181,  2,217,244, 83, 38,
+	166,100, 74,231,216, 26, 81,221,114, 50, 88,163, 47,176,188, 81,119, 16,230,103,
+	 60,143, 26,243,143,198, 78, 44, 50,190,179, 98, 52,170,109, 21, 70, 98, 25, 59,
+	 57,216, 61, 91,194,240,121,183,170, 84,153,219, 26,152,199, 20,159,194,160, 54,
+	 62, 55,154, 25,226,166,158,106, 38,203,227,  7,152,151,178, 29,238,171, 12,  5,
+	193,171,100, 71,148, 52, 83, 68,233,190,185,159,159,203,136, 13,240,167, 67,186,
+	 80, 71,158,152, 64,175,142, 97,255,163, 59,  2,202, 67,113, 20, 44,216,189,153,
+	238,165,  6,205, 68,154,103,168,124, 87,247, 94, 16,136,132,118,110,205,143, 62,
+	126, 33,205,195,216,201,235,  6, 16,101,206,252, 21, 26,  7,159,129, 61, 92,250,
+	  6, 96,190,216, 26,191,122,157,150, 65,219,196,209,183,249, 50, 67,199,230,128,
+	190,212, 95, 36,110,163, 50, 79,238,118,188,194,222,165,191,139,133, 24,215, 45,
+	 93,205,  9,143, 49,224,212,141, 93, 77, 52,232,239,252,185,156,174,134,224,146,
+	 32, 99,145,140,196, 60,255,244,148,128,100, 33, 65,164, 62,  6,122,171, 90,220,
+	 88, 27,222,118,154,125,232,234, 76,102,  6,104, 50,120, 97,244, 21,110, 16,217,
+	118,218,140, 51,174, 48,241,133,146,  6,  8,108,254, 20,216, 61,176, 38,125,206,
+	149, 61, 31,204, 50,140,229,236,159,169,216, 12, 69,250,  2,174, 13,221,156,  4,
+	 28, 41,  3, 78,244,215,192,193, 54,134,169,217, 83,117,212,143,158,241,109,178,
+	 32,203, 70,194,123,227, 48, 15,151,208, 70, 30, 25,165,107, 71, 46,120,209,223,
+	148,243, 24, 64,184, 91,194,232, 41, 44, 90,194,139,121,227,  6, 36,236, 62,200,
+	254,131, 10, 96, 78,136,  6,163,120,205,126,158, 29,157, 53, 33,133,121,185, 38,
+	  5, 55, 81,231,190,132,241, 62,191, 53,145,  4, 90, 88,  2, 60, 19, 55,  4,141,
+	 76, 17,105,165,171,254,153, 79, 82,135, 80,187, 55,174,115, 11,125,200, 57, 75,
+	243, 76,236,109, 92,178,127,227,156, 96,142,132,125,132,133,147, 99, 40,211,121,
+	 43,158, 61, 57,166, 71,184,210,186, 42, 84,199,168,116,172,224,240,  8,189,101,
+	 62,158,226,  0, 55,186,176,194,146,111, 44, 15,249,  8, 67, 59,153,248, 23,125,
+	126,167,141, 29,195,119, 78,135,  0,197,  1,250,181, 42,146, 30,141,209,113, 36,
+	190, 75,117,131,174, 13,104,126, 37,233,109,186, 19,146,109, 41,142, 40,192, 11,
+	198,166, 66,121,119,150,178, 38,189, 49, 59,113,172,238, 65,156, 36,175, 31, 37,
+	181,231,172,139,140, 96,141,182,202,112,170,177,194, 55,104,180, 80,117,238,217,
+	149,209,185,105,160, 15,195, 12,176, 86, 14,122,  8,  1,231,  8,  1,206, 16,229,
+	110,214,147,101,128,  3,214,130,240,157,235,171,176, 18,179, 51, 27,152,  3,134,
+	 27, 77, 54,116, 28,236,122,110,150, 26,105, 53,230,201,252,115,188,200,  3,100,
+	159,181,155,103,251,  7,176,245, 72, 63,179, 13, 64, 64,106, 44,101, 86, 16,200,
+	 17,156, 35, 66, 13, 32,250,225,146,207,243,114,174,254,212, 96,155, 81,170,175,
+	142, 30,  1,204, 22,200,196,161,126,140, 41,  5,194,212, 19, 59,238,208,246, 37,
+	 56,200,117, 11, 20,190,117, 59,167, 73, 76,213,  5, 16, 29,184,232,184,246, 94,
+	224,155, 35, 57,128,223,168, 54,145,175,152, 37, 69, 88,240,217, 78,216, 57,208,
+	 55,228,253, 15, 53,  0, 14,217, 87,206,231,254,207,229,189, 43,247,205, 14, 88,
+	 59, 28,116,183,103,  5, 29, 72, 97, 95, 47, 43, 15,160, 14, 61,255, 89,122,165,
+	 48,235, 90, 93,106,142,185,177,248, 47,  9,212,254,129, 39, 29,220,112,131,242,
+	181,219,110, 62, 52,218,225, 75,  5, 32,249,236,122,121,226,159,  4,138, 31,194,
+	 22,234, 35, 78, 97,  0, 35, 25,192,138, 94,239, 42, 23, 23, 90,227, 73, 49,144,
+	211,117,104,111, 16,161, 24,212,135,163,  0, 47, 78,138,205,231, 88, 29,  9,226,
+	 16,128,180,  2,189, 88,105,151,147,203,246,117,128, 60,250,156,119,229, 52,195,
+	 21, 71,248,101, 98,170, 13,189,255, 17, 15,133,204,247, 92, 48, 61,  7, 68,212,
+	 31,151,111,112,  5,110, 60,110,248,222,214,143,207, 96,228,190, 46,216,186,168,
+	 49,181, 33,223,115, 31,227, 80,161,231,252,215,148, 24,198, 33, 29, 20,191, 10,
+	190,143,136,111,137,158,164,160,110,201,166,253,125,252, 72, 11, 89,230, 60,213,
+	175,155, 15,200, 51,250, 80,126,240,245,177, 32,245,117,188,226,121, 58, 58,234,
+	109, 60, 38,242, 27,175,  5,245,144,248,145,201,126,149,229,213,232, 60,125,187,
+	201, 30,168,231, 81,170,183, 81,140,110, 74,229,121,239,160, 96, 56, 97,165,199,
+	 83,249, 17, 16, 91,244, 80, 83,223, 49,252,201, 59,170, 15, 31,113,176,135,  3,
+	 13,133,252,160, 45,152,166,238,153,192,251, 20,232, 11, 56,167,209,163,113,108,
+	180, 82,178,208, 50,150, 79,115,193,198,231,187,203,200,146, 53,131, 37, 21,124,
+	232, 13,105,223,106,152,154, 88,165, 25,158, 48,193,  5, 42,110,177,  8,169,100,
+	 64,133, 58,201, 22, 47,206,146, 16,249,150, 11, 13, 45, 82,243,125, 41,148,227,
+	171,182,227, 56,178, 91, 51,243, 16,177,148,103,107, 45,181, 74,106,190,132,169,
+	134, 45, 82, 71,184,140,243, 41,234,144,197, 53,242, 88,142, 58,115,255, 98,249,
+	163, 26, 34,  5,184,131,156,248, 51,235,115,111,198,199,158,108,153,  9,234,125,
+	202, 14,112, 33,143,134, 78,234, 77, 66, 52,234, 12,239, 73, 35,127,222,209, 15,
+	 74,116,102, 95,229,114, 93,192,174,187, 84,141,108,235,  2,223, 59, 67, 53, 39,
+	 44,149, 48, 95,103,213,146, 46,185,146, 34,184,227,113, 57,243,102,254, 83,252,
+	 12, 73, 15,165, 96,239,111,210,245,249, 25, 86,107, 91, 44, 97,146,  0, 87,222,
+	246, 68, 10,204, 67,125,146, 52, 60,145,189,153,146, 25, 48,163, 11,160, 72,152,
+	243, 65, 72, 48,  5,196,146, 67, 23, 29,200,251,187,253,164,168,209,143,238,170,
+	 90,177, 12, 44,197, 94,121,196, 29, 62,204,148,  4,243,165, 74, 87,171, 83, 58,
+	 54,207,222,154, 60, 60, 96, 31,114, 19,206, 70, 81,136, 36, 59,136,180, 48, 35,
+	250,103, 14,199,180,132,164,253,239,168,129,132,124,109,249, 29, 74, 58, 93,127,
+	232,159,145,146, 20,173, 62,240,200,212, 82,152, 39, 15,117, 94, 30, 70,221,217,
+	194,113, 51,144,134,206, 85, 59,109, 83, 64, 61,149,133, 55,  1,206, 71,196, 22,
+	 69,132,197, 34,206,163,181, 72,119, 50,221, 24, 17, 21, 71, 59, 95,123,115, 15,
+	165,186,109, 38,121,208,115,139, 99, 32,  3, 33,163,127, 92,190,158,183, 57,195,
+	 92,164, 24, 88,187,246,113, 20,243,161,  9,121,241, 51,124,168, 64, 84,  2,254,
+	202, 45,235,254, 38,188, 55,161, 90,186, 83, 56,170, 97, 71, 29, 79,168,140,248,
+	130, 10,193,211,  6, 18, 96,218,162,143,233,209,114, 89,104,185,205, 38, 26,168,
+	 87, 78, 36, 41, 61, 17,106,100, 18, 57,221, 15, 49,100,202,114,245, 92,147,110,
+	249,196,207, 26,233,190,  9,241,194, 49,156,117, 12,134,177,119, 42,186,158,162,
+	 33,200, 37, 30,227,197,155,224,130, 69,132,232, 55,145,222, 29,130,128,246, 11,
+	143,100,164,212,147,212, 50, 69, 85,227,227, 17, 28, 69, 67,168,193,116,190, 41,
+	 95, 62,207,247,215,161,214, 52,195,164,127, 48,159,  3,135,246,114,  2, 77, 36,
+	137, 39, 37,244,101, 49,223,252,137,197, 46, 81, 58,  4,219,100,220, 61,147, 98,
+	234,224,189,208,116,115, 88,162,213,105, 67,234,141,154,117,  5,199,110, 95, 16,
+	217,101,170,163, 34, 17, 13, 89, 77, 79, 21,176,  8, 14,128,182,  1,117,151, 99,
+	123,239, 68,136,225,130,204, 99,159,144, 51,236,192,216, 79,152,104, 72,239,197,
+	 25, 24,113, 82,221, 44, 36, 89, 49,101,118, 57,204, 47,142,224,  9,217,246, 85,
+	247, 87,138,201,219, 38, 60,198,253,189,204,227,199, 31,135, 80, 65,161, 90,207,
+	 39, 79,199, 30, 44,152,146,105, 93,105,181,  5,151,125,148,133,115, 36, 37,108,
+	173,  7,255, 17,142, 83, 45,206,200, 76, 79,  1,148,116, 38, 54,158,121,203,233,
+	247, 53,233,158,215,138,186, 44, 77,128,133,192, 18,171, 65,184,155, 62,107,156,
+	142,246,147,143,186,  1,138, 74,161, 76,223, 44, 39, 99,181,200,215, 45, 77,124,
+	 86, 97,145, 92, 83,195, 80,115,246,  0, 66,249,232,254, 74,184, 87, 74,186,160,
+	122, 37,214, 71,249, 94,185, 48,179, 89, 67,170,218,160,164, 48,245,188, 98, 29,
+	161,215, 66,244,158,102,182,204,102,155,249,108,241, 12,102,170, 48, 52,228, 87,
+	252, 83,228,220,105,140, 57, 29, 69,169,225,238,227, 49,  3,223,104,204,212, 66,
+	225, 82,211,217,  8,226,210,108,131, 95,186,255,222, 47,233,241,178, 64,148, 98,
+	171,136, 99,218,203,204,183, 85,214, 59,130,172, 81, 98,176,213,102,221, 92,246,
+	216,125,118,169, 27,171,196, 13,  1, 30,198,207,150,197,194,157, 16, 62, 57, 18,
+	 57,159,178,183,190,254,201,179,  7, 89,236, 12,107,140, 37, 90,165,162, 77, 88,
+	 23, 22,115,133,152,155, 61,145, 27,199,193,100, 78,104, 61,122,253, 87,190, 10,
+	101, 91,190, 35, 62,212,182,244, 37,211, 76,125,147,106, 66,177,229,126, 15,220,
+	 80,218, 20,220,113,177,226,112,178,112,100, 41,220,176,  7,196,181, 65,186,118,
+	109,198, 21,214, 46,246,111,163,209, 38, 82,203, 34, 70,179, 46, 17,142,124,118,
+	146,114,126,196,185,119,  4, 63,163,118,227,233,228, 57, 35,226,239, 71, 75,217,
+	186,229, 66,  7,230, 87,255, 35,184,248,103, 48,127, 60,230,191, 32, 23, 61, 94,
+	186,151,218, 45,222,205,248,118, 55,154,208,158,121, 97,  6,238, 41,210,127,160,
+	 77,187,105,145,207, 30,190,210,219,121,  2,181,160, 55,190,100, 96,241,186,233,
+	 63,141, 45,153, 84, 75,121,100,191, 25,109,247, 88, 65,121, 13,193,178,159,245,
+	151,108, 12,201,108,234,252,160,173, 19, 97, 12, 36,138,205,119,255,112,193,102,
+	  0, 64, 52,244,178, 48, 43,175, 72, 16,234,115,190, 97,165,253,222,246,148,237,
+	146,247, 17,  9, 74, 54, 28,254, 89, 54,  0,155,115,223,203,157,179,253, 21, 44,
+	102,117,137, 45,112,197, 74,199,187,140,177,153,138,145,145,155,104,230,201,234,
+	148, 52,232,162,209,101, 71,  1, 57,178,  9,170,236,175,227,156,236,144,150,180,
+	136,154,233,204,171, 40,190, 82,202, 63,191,125,231, 24, 72, 37,195,139, 87, 50,
+	 56,229, 38,215,  3,191, 43,108,110,150, 45,195,196,248,207,  9, 50,191,161,225,
+	 15, 23, 83, 65,120, 50,187,208, 80, 91, 39,145,165, 86,107, 84,198,185, 81,251,
+	 42, 46,208,155,255,230,240, 88,207,  2,226,115,106, 15,133,129, 28, 85,212, 42,
+	246,157, 70,161, 90, 34,234,223,164, 50,155,140,188,227,145,217,124, 21,207,240,
+	 62,119,197,135,134, 17,246,147,100,187,145,233,  6, 70,143, 46,144,205, 30,  7,
+	122,126,116, 95, 56,137, 87, 97, 18,110,191,170, 43, 75, 26,193,227, 81, 54,113,
+	161,203, 24,120,164,217,129,147,199,187,253,237, 53,134,202, 84,185,242, 48,189,
+	200, 40,253,139,212,111,133, 60,173,175,125, 51,199, 70,  3,219,161,174,142, 93,
+	 83, 60,177,187, 79, 29,136,224, 85,150, 95,187,123,101,202,228, 97, 80,173,248,
+	 95, 59,108, 76,142, 11,112,158, 10, 66,110,  2, 36,209, 48,105,177,127,113, 12,
+	250, 59,157,217, 92, 56, 16, 54,227,162,230, 80,237, 88, 55,108, 44,126, 59, 91,
+	153, 21,113, 36,205,212,254, 66,179,141, 22,207,227, 40, 35,206, 76,203, 84,102,
+	 90, 25, 51, 39,190,228,216,213, 57, 29, 37,250,161, 81, 46,166, 21, 67, 53,131,
+	 56,230, 60, 67,178,234,226,143,133, 21, 81, 50, 88, 86, 63,109,214, 92,167,237,
+	161,174,214,143,203, 74, 80,186,110,140, 25,197,243,154, 55,204, 34, 59, 76,217,
+	220,188, 16,144,214, 16,216, 76,104,196,140, 85, 59, 27,163, 36,146,223,187,184,
+	 51,124,165,193,226,102,171,130,152,  2,161,170,250, 71,129,183,165, 60, 15,225,
+	 48,143, 17,222,220, 73, 14, 88,212,199, 48, 49,119,220,140, 45, 93, 61,241, 30,
+	 31,126, 99,171,181, 82,209,210,236,238,  6,154,151,191,175, 11, 30,246, 92,149,
+	216,103, 60,190, 86, 92,120, 12, 64,137,210,140, 91, 25,142,197, 33, 76,229,210,
+	216,103, 18,221, 52,217, 87,157, 54,141,171,221,166,218, 77,113, 51, 56, 78,137,
+	248, 79,223, 23,184,114, 76, 61,161,166, 48,186, 36,183,152,117,245, 97,159, 91,
+	  6, 82,236,112,117,180,190,201,104, 29,234,143,154,119,147,198,236,240, 77,188,
+	214,249,141,179,118,173, 15, 89,180,143,133,127,222, 59,110,158,205,107,251,234,
+	182,228, 50,171,203,177, 45, 30,  4, 86, 67,147, 75, 81,  4, 22,105,188,204,216,
+	234,152, 28,183,102,163, 89,  9, 50,236, 99, 23, 96, 70,150,194,141,155, 74,155,
+	133,253, 59,200, 81,100,147,117,119,127,169, 49,158, 19,164,128,231,201, 81,138,
+	129,116, 29,192,248, 24,243,202,254, 54,183,123, 38,128,185,252, 30,  8,204, 95,
+	219, 18,181, 24,110,182,101,107,221,207, 77,148,234,176, 86, 37,108,  6, 72,255,
+	226,  7,121, 92, 95,121,140,224,  4, 15,165,212, 99, 98,198, 98,177,251,111,168,
+	112, 27,  8, 39,193, 17, 79, 94, 35, 28, 71,206,119,239,124,163, 86,250,  3,212,
+	 36,180,246, 55,193,110,232,255, 12,145, 71, 90,117,131,250,174,155,137,241,  5,
+	 74, 96, 99, 23, 19, 44,181,126, 74, 76,207,255,179,105,216, 80, 48, 19, 11,113,
+	103,173,177,  2, 61,  9, 81, 11,121,104, 18, 79,225, 47, 61, 71,250,247,222,241,
+	 71,183,213,123,121, 75,195, 50, 30,196, 16,210, 67, 45, 43, 95, 90, 24,209,208,
+	 86, 99,206, 21,203, 64, 42,111,250, 33,221, 79,214,227,210,186,  9, 46,157,193,
+	170, 53,144, 14,246,232, 89, 17, 50,159,  1,188,225,187,173, 65,210,211, 18,221,
+	149, 94, 36, 61,153,  1,212,187,173, 30, 71, 21,  5,223,146, 53,154,142, 99,153,
+	133,220, 98, 95,205,  0, 59, 56, 58,139, 97, 79,182,  7, 87, 85,112, 36, 45,133,
+	139, 44,181,228, 23, 58, 71,142,163,197,177,248,  0,152, 27,199, 35,204,238,156,
+	248, 76,192, 99,  6, 96,147, 40,198, 20, 20, 62, 31,132,225,239, 79,213,  1,220,
+	 54,168,211,101, 88, 38,146,180,186,168, 21,243, 23, 24,  8, 30,251,197,109,168,
+	154,173,163,198,112,208, 64,235,206, 93, 55,245, 17, 60,115,118,101, 69,248, 77,
+	 57,204,228, 64, 61,138,180,134,211,  4,158,152,154, 32,144, 38,214,245,180,178,
+	172,132,153, 64,150,217, 33,199, 80, 28,156, 49,121,116,180, 10,145, 36,253,  6,
+	 77,237,204,208,120, 62, 18,163,203,194,225,212,124,197,125,171, 83, 60,187,137,
+	199,229,125, 55,155,116,141, 82,106,234,170,130,100, 77, 88,213,184,140,134, 46,
+	159, 47,211,183,249,140, 47,247,105, 92,120, 75,123,162, 95,154,133, 24, 29,185,
+	216,254, 31,102, 70, 11, 50, 69,137,210, 48,162,241, 44, 99,216, 35,200,247,121,
+	117, 38, 74,107,223, 65,157,171, 46,163, 16, 74, 58, 45,166,154,107,216, 16, 74,
+	114,103,184,171,167,193,120, 78,110,141,144,  5, 94,112,  8,185,149, 41,239,238,
+	131, 64,209, 30,190,241,162, 56, 11, 39,173, 50, 44,146, 39, 13,151, 39,131,173,
+	147,237,129,200,  6, 23,204,173,177, 34,106, 29,203,233,253,215, 11, 53,  1,131,
+	 70,136,168, 10,201, 46, 52,125, 26,127, 49,196,239, 49, 98, 62,227,105,155, 59,
+	 54,118,159,233,159,212,131,189,229,  5,110,107, 77,164, 28,192, 78,203,211,238,
+	153, 54,219,233,240,155,113,108,164,205, 51, 40,195,169, 24,159, 88,188,227, 99,
+	 64,116,208,229,115,  2,242, 33, 32,223,227,212, 98, 15,168, 10,104,126,125,160,
+	219,225,220,155,181,220,188,151,162, 87,161,233,160, 91,248, 79,128, 51,250,136,
+	199,216,111,142, 47, 63,198,253,147,115, 88,220,240, 63, 97, 81, 31, 36,  9,255,
+	155, 29,241,135,190,231,153,254, 41, 19,149,217,206,159,118,168,206,132,197,193,
+	206, 79,183,218,243,148, 89,138, 46, 95,108,124, 56,224,182, 95, 33,  9,194,149,
+	 59,150,245, 64,146,134,145,255,101,181,202, 77, 93,229, 94,177,104,139,147,251,
+	 73,209, 23,107, 31, 94,250, 72, 55, 56, 71,  9,176, 71,198,176,173,217,140,159,
+	 40, 33,140,115,123, 43,230,202,215,116,213,113,254, 27, 49,129,120,158,179,144,
+	235,189, 64, 57,  8, 94,162,118, 33,150,  8, 11,153,193,153,151, 41,228, 86,212,
+	125,197,221, 93,185, 84,219, 30, 79,183,178, 48,127,215, 91,246, 93,225,221,194,
+	 81,105,135,162,253,224,229,239, 18,158,228,128,121,136, 27, 35, 79, 23, 72, 73,
+	 16,160,195, 13, 10,100, 20,  5, 24, 84,198,146, 81, 63, 44,189,189,  8, 72,236,
+	 15, 77,110,131,159,165, 99, 83,169, 60,162,246,165,151, 58,146,225,206,164,117,
+	206,213,249, 99, 37,172,183, 60, 10,169,234,110, 69,223,147,180, 84, 41, 64, 29,
+	240,194, 66,239, 70, 90, 78,160,162,142, 75,228, 91,171, 23, 20, 79,173,124, 13,
+	 52, 62, 90, 89,231,123, 14, 72, 94, 97, 12,157, 69,141,132,249,109,154, 46,173,
+	 44,246,135, 66, 25,230,171,156,197,100, 99,145, 61,241,192, 79,  4, 31,225, 23,
+	  1,234,163,  2,128,147,145,206, 79, 71,181,188,235,230,123,237,168,191,147, 44,
+	 72,196,200,241,152,228, 68,148, 78, 63,210,  1,228,157,100,182,138, 33, 96, 43,
+	 74, 64, 49,241, 13, 63,147, 66, 24,180,222,188,232,103,101,111,226, 96,108,115,
+	236,130,192,129,246,163,107, 31, 14,174,177, 76,217,120,121,207,195,161,162, 48,
+	152,219,  7, 49,165,172,251, 16, 44,136,235,119,104,236,190,186,238,107, 47, 77,
+	 55, 52, 42,243,111, 28, 89, 83, 87,110,  4,199, 40,  4,228,214,237, 79,212,180,
+	  4,116, 43,188, 77, 50, 23,247,174, 30,210, 94,231, 83, 88, 42,240,181,124,192,
+	121,168,174, 34,113, 36,107,131, 88,240,227,181,128,119, 57,160,190,184,236,124,
+	 83,102,233, 31,125,160,216, 51,201,186,244,226,234, 28,213,125, 79, 20,137,133,
+	141, 43, 24,126,167,121, 99, 60, 36,103,180,178,245, 50, 11, 85, 75, 51,152, 44,
+	140,136, 39, 90, 11,174,255,131,240,158,100,164, 86,245,238,118,122, 97, 22, 92,
+	229,189,204,100,212, 66, 18,228,232, 80, 79, 36,149, 92, 44,133, 47,108, 80, 15,
+	 75,123,108,242,200, 33,210,199,191,221, 87,192, 51,145, 37, 93,112,113, 79,110,
+	162,180,123, 67, 77,241, 26,185, 66, 39, 23,217, 10, 55, 37,223,214, 28, 81,242,
+	  2,218, 51,235,149, 65,155,191, 24,185,  1, 46, 51,225,120,  8, 58, 62,173,133,
+	208,166, 46,154, 28,244,194,250, 23,249,104, 37, 77, 83,196, 60,184,113,177,129,
+	131, 95,172, 99,155, 11,145, 92, 40, 88, 98,228,185, 46,207, 45, 27,167, 85,105,
+	116,  2,192,251,159,143,176,  8,199,120,176,165, 97,239,112,117, 84, 80,254, 30,
+	 27,239,130, 71, 29,192,114,101,124, 81,125,140, 50,183, 43,175, 43, 67, 29,222,
+	 55,172, 63, 23,142, 89,196,128,157,234, 51, 50, 79,107,231,211, 68, 59,140, 68,
+	236,225,202, 69, 41,206, 29,141, 38,124,150,213, 76,180, 24,221,131,152,185,176,
+	195, 69, 43, 75, 18,179,101,148,205,175, 35,231,242, 54,165,156,193,184, 46,254,
+	 79,  5,211,185, 20, 62, 43,211,  5, 51,114,107,119, 98, 33, 12,157,129,142,148,
+	255, 15,168, 29, 69,243,213,134,208,119,185,156,140, 69,144, 92, 91, 22,240,182,
+	122,214,238,172,135, 98, 57, 17, 44,189,211, 79, 62, 62,243, 30,134,228,148,125,
+	152,109,143,145,163, 91,254,231, 69, 51,144,110,125,213, 26,245,202, 81, 52,231,
+	 49,241, 87, 93,237,118,112, 35,221, 27,197, 70,145,116,166,  6, 11,145,104,135,
+	182,157,139,216,112,246,109,189, 41,194, 47,245,248,122, 27,203, 22, 31,208,172,
+	167,240,119, 80,102,199, 85, 22, 63, 60, 60,201,200,142, 72,204, 34, 18, 84, 81,
+	254,214,215, 22, 20,185,244, 75,253, 92, 64,186, 54, 43,151,189,131,106,132,100,
+	 42, 35, 94,232, 78,106,239,181,160, 60, 58,184, 91,177,151,152,169, 24,114,160,
+	 23, 87,144,239, 45,202,140,100, 81,137,148,250, 59,190,220, 20, 53, 45,114,149,
+	 42,123, 38,201,144, 66, 74, 22,108,119,123,229,223,248,170,140,143, 80, 93, 19,
+	237,245,148,249,236,  5, 32,196, 25, 98,234, 15,207, 24,101,178,236, 82,211,138,
+	215,202, 91,  6,185,243, 28,195,196,103,146,166, 75,115,134,243, 38, 30,187,165,
+	221, 45,199, 41,252, 20,175, 49, 21,122,147,193,143,226,122, 94, 71,123,236,192,
+	238,  4,159, 72,225,119,203,222,117,234, 50,124, 75, 84,206, 97,118,142, 78,102,
+	 22,  4, 26,131,158, 26,142,172,147, 50, 14, 76, 60,180, 39,249, 30,188,128,107,
+	163,100,160,130, 11,133, 13, 99,147, 70,192,240,204,253,238,213,249,161,196, 78,
+	 96,194,127, 61,118,243, 49, 44,204,143,110,253,148, 58,133,150,172,244,149,  9,
+	201, 22, 69,  9,142,235,158,204, 10,128, 62,217,224, 19, 58,200, 70,  5, 10, 94,
+	174,  9, 83,180,  8, 98,180,128,244,250,  1, 70,208,166, 32,155, 54,191, 54, 73,
+	159,126,157,109, 56,102,159, 78,211,178, 30, 76,247,147,234,202,172, 45,210,239,
+	115,205,166,137, 32, 45, 67,148, 59,108,165,182,130, 47,222, 45, 25, 26,169, 47,
+	214, 36,190, 65,249,167,244, 92,212,145, 72,181,202,146,149, 56, 87,242, 75,  5,
+	 40,133,189,223, 47,135,202, 20,143,203,100, 27,105, 14,185,139,173,208,183,146,
+	217,226, 59,  3,152,164, 87,148, 55,113,250,244,106,142,170,104, 18,186, 68, 36,
+	 20,238,172,215, 60,226,102,170,  6,112,100,125,145, 16,185, 40,174, 81, 72,119,
+	 24, 58,  1,111, 52,160,  3,151,118,  3,168,106,148,215, 57, 66, 93, 60, 20,118,
+	  1, 37, 59, 82,  4,196, 66,159,172, 97,  0, 62, 16,168,225, 64,193,182, 57,140,
+	162,177, 98, 43,237, 63,131, 21,226,231, 63,  6,138, 52,243,216,128,110, 37, 56,
+	223,142, 75,118,138,247, 26, 30,243,131, 90,175,230, 35,  5,151, 50, 44,236, 72,
+	208, 64, 34,106,241, 86,156, 36, 32,140, 79,132, 76,184, 62, 75, 88,214, 79,233,
+	 48,102,117, 53, 46, 54,139,150,171, 95, 73, 52,226,  7,167,104, 60,161, 53, 45,
+	 91,122,168, 70,138,173, 28,118,146, 30,182,207,127,228,148,173,105,214, 82, 38,
+	191,234, 83,240, 91,140,171, 10, 72, 17,154,158,218,100,127, 83,248, 66,  6,211,
+	216,206,199, 39, 69,128,170, 15,186,145,132,242, 73,192,130,111,226, 28,199,203,
+	240,214, 19, 84, 98, 56,247,250,174,104,  6,132,  8,143, 36,162,197, 61,214,210,
+	 18, 94, 53,155,189,249,133, 80,156,113, 63,235, 73,224,223,133,164, 11,184, 81,
+	 36, 56,101,245, 26,164, 94,143,207,108, 40,166,142,242, 96,  0, 63, 73,201,240,
+	162,155,110,225, 27, 73, 68, 24,  7, 60,158,244,109, 46, 84,  0,155,244, 88, 40,
+	 58,127,209,127, 28,122,151, 25,213, 69, 98, 56,184,239, 18,170, 98, 81,222,175,
+	 49,124,125, 85, 35, 71, 45,173,187,  2, 80, 52,158,120,228,143, 46,229,227, 81,
+	 90,205,239,188,193, 20,178, 11,143,196, 55, 35,165,198,113,204, 44,  2,101, 65,
+	245,235, 70, 75, 63,186, 74,201,176, 37,119, 89, 11,154,222, 12,165,130,240, 80,
+	232, 17,231, 55,174,142,139,138, 31,153,255,117,196, 61, 54, 17, 95, 54,232,166,
+	232, 55,160,173,108,191,225, 40, 95,230,222, 74, 92, 79, 89,168,166,203,246,181,
+	214, 30,188,180, 20, 54, 26, 63, 36,214,217,171,135,180, 11, 89,213, 41,  2,195,
+	 60,187,219, 65,103,115,116,188,136,195, 85,  9, 50,214,164,176, 94, 97, 81, 34,
+	148,121,217,123,248, 58,111,152,177, 20,124, 52,197,174,159,194,248,121, 24,255,
+	152, 55, 34,146,190,208,136,255,148,112, 55,  5,  2,  1, 79,184, 56,168,242, 14,
+	218,165,215,117,171,168,227,151, 22,212, 71,233,170,222, 65,111,  8, 74, 92,221,
+	 44,159,245,125, 71, 45, 96,218,157, 29, 45,234, 95,243,139,122,142,111,154,144,
+	211,165, 11,  5,164,188,171, 51,186,  8, 34,135, 14, 44, 28, 10, 73,195,210,108,
+	143,153,221, 75,190, 65,155,239,112,118,196,182,132, 72,  7, 82,182,219,212,138,
+	160,237,149, 71, 17,187, 47,167,202,229, 92, 58,155,180,  1,159,228,167, 56, 29,
+	221,246,248,168, 66,236,126, 69, 59,199, 67,217,196,210, 37,186, 84,253,209,176,
+	228,207, 17,189,247,236,102,198, 10,106, 90, 52,168,134, 42,127,225,233, 72, 99,
+	 72,  0, 19, 59,149,242,110, 14,154,104,192,208, 63, 93,136, 99,180, 86,240,219,
+	193,135,100,170,147, 47,119, 54, 51,128,122,194,236,156,238, 25, 80,  3, 68,184,
+	 31, 38,217,253,213, 60,210,253,220,252,152, 55, 22,250, 15,128,  7, 79, 27, 12,
+	198, 45, 23,  1,  6,124,167,129,214,165,188, 65, 75,128, 19, 96,123,183, 82, 70,
+	 14,154, 68, 70,244, 50,171,119, 36,237,157, 52, 68,230,  9, 63,189,139,225,208,
+	128, 22,234, 15, 28,176, 45,250,166,254, 85,201,123,178, 51,126,222,232, 14,238,
+	 50,140, 46,145,115,  9,199,201,189,146, 39,190, 47, 90,151,212, 59,231,130, 92,
+	  0,121,232,100, 45, 39,153, 62, 21,204,189,216,148,107,148, 70,102,226,  5,191,
+	164, 95,115, 10,195,153,138,164,232,194,129,180,237, 95,162,123, 21, 58, 76,108,
+	  5,195,133,252,163,200,209, 64,207,  7,111,128,114, 79,173,  5,  5, 85, 73, 55,
+	 48,172, 83,176, 11,143,234,213,213, 27,117,219, 92,200,215, 58, 84,171, 47, 63,
+	107,165,115,187,252,228,145, 86, 96,195,231,210,134,216, 45, 97,103, 11,190,219,
+	 13,162,214, 13,  9,183,157,225,121,235,169, 53, 84, 65,138, 68,199,204, 85, 88,
+	108, 97,225,157,124,138,196,159,195,228, 42,215, 31,106,141, 56,  8,248, 44,242,
+	  3,190,139,  8, 52, 51,248, 42,148,254,169,213, 99,106, 79,195,130,193, 66, 73,
+	 30,226,129,250, 12,255,191,209,122,248,187,179, 42, 51,173, 87,117,162, 77,  6,
+	248,194,249,228,176,166,239,196, 33,243,233, 78,228,224,119, 57, 51,106,156,142,
+	131,127,196,221, 77, 79, 48,132,203, 62, 27, 43,171,168,194, 84,170,  9, 30,189,
+	 38,158,110, 15,200, 56, 81, 40, 43,176,181,249,207,187, 66,209,187,192,185,157,
+	122,  8,107, 51, 97,193,192,178, 44,  0, 30,  7,151,100,185,204,192, 52,220,  5,
+	 48,122,254,  4,153, 12, 42, 24, 80,236, 69, 10, 33,205,168, 44,254,169,110,101,
+	250, 73,253,229, 56,  5, 19,213,239,  4, 43, 65,226, 96,  1,186,199,125,173,206,
+	230, 37,  1, 58,176,231,247,127,231,230, 96, 25,219, 97,169,129,216,252,194,245,
+	 87, 91, 19, 90,196, 93, 14,116,241,226,211, 69, 71,153,133, 85, 63,191,165, 36,
+	 34,179, 46,170, 68,117,240,254, 76,163,191, 86,144,175, 51,164, 56,198, 28,166,
+	239,  3, 82,120, 29,170,123,251,154, 43,169,106,231,165, 72,  4,158,234, 14,141,
+	251,243,145, 37,161, 29,159,126,101,118,153,195,237,149,198, 58, 94, 76,194,111,
+	242,210,192, 82,125,197, 16, 77, 31, 26,255,109,133,127, 28,174,175, 92,186, 49,
+	110,122, 76, 47, 90, 33,167,  3,153,171, 10,115,252, 45, 64, 67,121,102, 90, 44,
+	150,170,  0, 36, 26, 26, 99, 28,244,162,226,138,158,172, 71,151,227, 11,194,206,
+	 60,201,151,196,129,  7, 23,241,111,137, 63,201, 29,  3,166, 30, 38,147,187,  9,
+	 57,161, 37, 57,199,137, 26,117,109,105,166, 97,250,222,183, 22, 70,250, 15, 97,
+	176, 21, 40, 10,253,105,172,157,167,131, 67,211,170, 17,157, 78, 62,127,140,210,
+	241, 50,139, 79, 15,102,253,  1,242,254,193, 10,233, 10,218,135,231,243,248,184,
+	235,114,123,118,128,158,194, 89,209,128,138,224, 95,111,102, 63,196, 47, 71,141,
+	213,218, 14, 15,149,202,229,101,140,107,184, 11,145,103, 60,142, 44,214, 70,151,
+	133, 68, 42,186,102, 92,  3,128,144,  3,121,234,202,154, 87, 42,205,174,  5,131,
+	205,126,193, 99, 86,135, 65,133,  3, 54,228,143,175,228, 69,232, 63, 55, 43,222,
+	110, 70,121, 35, 26,189,117,110,225, 60,232, 24, 33,196,101,151,145, 52,182,135,
+	 32,235, 71,102,131, 41, 56, 81,245,163,  8,103,126,244,207,132, 15,223, 25,178,
+	217,128,198,115,102, 47,106,180, 91,233,134,213, 48,102,219, 10,246,247, 62, 79,
+	 70,212, 34,166, 59, 47, 87,250,199,220, 56,180,132, 82,222,127, 69,166,164, 34,
+	180,172,211, 13, 28,153,123,161, 82, 74,144, 45,118, 14,196, 58,  9, 88, 19, 79,
+	 62, 29,138,147,196,147,197,144,127,147,191, 71,252, 33,139,171,158,194,106,142,
+	114, 18, 50,231,139,202,243, 91,228, 67,245,233,182,248, 75,105, 48,117,141,125,
+	105,201,116,207,217,239,180, 31, 75,116,168, 85,204,160,228,118, 57,135, 87, 64,
+	216,  9, 78, 82,113,187,  4, 10, 68, 58,220,234,230,226,233, 42,153,253, 10, 49,
+	 89, 28,117,121, 12,226, 21,246,220,148, 31,171,160,  5,176, 44, 88,125, 10, 22,
+	192, 85,228,242,  6,160, 89, 16,122,116,153,154, 97,206,168,126, 44,212,244, 11,
+	210,117,153,212,190,116,254,182,127,204, 97,122, 53, 71, 88, 32, 94,131,208,207,
+	167, 39,120, 88, 65,132, 67,253, 88,185, 79, 85,215,213, 25,111,  3, 65, 79,223,
+	204,227, 32,166,161, 49,161,109,197,157,206,229,143,125,105, 46, 90, 83, 87,233,
+	 94, 57, 56,213, 52,148,130, 98,210,158,232,  9, 40, 62, 48, 26,115,101,158, 57,
+	 55,168, 46,251,106,249,163,237,107, 14,243,110, 17,105, 94,168, 78,128, 57,139,
+	122, 36, 15,209,218,189,  8, 33,227,  5, 20,185,121, 68, 81,  3, 60, 19, 19,199,
+	174, 76,232,179,234, 86,215,107,125,165,216, 24,153,102, 26, 35,182,137,226,207,
+	218,184, 63,107,174, 59,177, 33, 36,129, 85,124, 38,119, 51,229,106,136, 54, 97,
+	 98,227,172,130, 47, 36, 61,  2, 71,196,111,114,240,117,176, 19,126,236, 40,142,
+	167,176, 92, 84,127, 56, 29,112,109,210,120,244, 65, 73,154,122, 64,173,144,176,
+	 31, 91,177, 21,193,198,126,230,238,129,235, 35,212,112, 62,240,188,213,113,252,
+	245, 41, 98,116,157,147,174, 24, 49,170, 20, 68,239, 62,143,239,131,167, 15,254,
+	238, 27,  6,167,185,168,145, 52,194,220,219,253,232, 91,125,237, 89, 74,189, 89,
+	 34,207,131, 31, 85,171,128,149, 74,251,254, 20, 20,119,  1,218,191, 14,158,123,
+	216,197,153,218,179, 20,240,129,113,156,228,188,  1, 21, 15,251,136,188, 61,210,
+	 56,156,119,224, 89,142,133,250,245, 69,119,255,  3, 72,255,  2, 50, 47, 85, 64,
+	 95, 98,192,197,173, 78,115, 30, 12, 22,184,244,137, 21,143,232,142,180,113,210,
+	122,198,143,251,214, 29, 72, 53, 31, 45,237,224, 31,183,162,203,110,121, 82,181,
+	171,118,152,227,121,227,171,185,145, 45,200, 10,121,106,210,238,108,176, 90,180,
+	240,135,212,150,107,109,157,117, 53, 32,194,141, 58,103, 40,171,129,107,226, 16,
+	 96,192, 14,134,  3,  5,190,  1,254,225, 61,209, 41,251,216,158,108,206,182,224,
+	198,234, 17,214,193, 18,216, 64, 91, 29, 78,130,131, 36,194,212,105, 28,215,179,
+	193, 53, 49, 22, 39, 39,173,121,  3, 72, 44,213, 89,182,140,167, 56, 90, 78,162,
+	200, 62, 51,148, 19, 82, 34,  8,155,167,175, 24, 91,178, 86, 40,157,178, 61, 51,
+	 43,  7, 80,211,224,201, 68,246,205,140,167,142,222,168, 19, 85, 92,164, 32,243,
+	 34, 19,219,196,199,245,141,174, 38, 19, 95,137, 52,184,175,161, 55, 20,213,108,
+	 60,245,205,219, 58,194,138, 95, 81,223,223, 82, 93,245, 71, 11,186,106,253, 68,
+	248,  9,199, 89,171, 79,196,168, 50,173, 65, 27, 23,226,  2, 23, 40, 45, 24,110,
+	187,182, 25,205,202,182,145,252,149, 36,146,255, 55,178,236,214, 49,208,102,144,
+	200, 95, 77,201,172, 86, 60,  7, 85, 95,184,206, 34,212,159,  0,  4,151,226, 61,
+	155, 34,247,104,243,183,161,230,160, 92, 89,110,219,244,250,229,243,218,106,231,
+	 53,101,185,247,164,151,126, 80, 44, 94,106, 25, 20, 38,132,202,136,108, 38,152,
+	 95,129, 45, 83,217,211,157,  0,203,  4,196,  1,218,206,180,123,194,146, 70,160,
+	110,174,  5,113, 38,182, 96, 34, 46,171,123,205,166,189,137, 97, 69,209,195,254,
+	 89, 45, 76, 60,163, 89,157,145,182, 77, 56, 31,136,240, 59,154,163,169,172,243,
+	 63, 95,247, 24, 59,150,188,250,184,212,157, 34, 39,130, 58,111, 12,165,247, 32,
+	132, 20, 38,148,149, 17, 85,162,165,121,110, 54,120,237,118,229,  0,103,204,140,
+	 84,116, 16,221,  1,222,134, 81, 94,138, 10, 74,205,103,245,204,186, 49,166,220,
+	102, 82,217, 21, 99,242,132,252,205,123, 99,249, 82,212,109,243,200, 16, 56,242,
+	 26,170,253,124,126, 38, 96, 70, 99,222,175, 66, 38, 19,200,152,227, 35, 45, 34,
+	 67, 97,222,189,156, 67,254,135,  4,  1, 46, 33, 62,234, 53,181,207, 15,182,229,
+	137,155,193, 46,140,140,214, 52,128,242, 16, 27, 25,198,234,224, 20,209,120,237,
+	 29, 58,185,134, 74,202,175,207,169,147, 55,225, 43,146,179,169,130,202,158,208,
+	203, 97,199, 11,211,238,198, 65, 27,238, 70, 84,104,145,176,143,240,  6,121,247,
+	 71,134,202, 75,254, 93,204, 30,148,128, 76,117, 59,144,127,215, 48,126,242,172,
+	138, 61, 72, 93, 82,183, 68, 35, 18, 85,109,112, 39, 55,119,232, 29,137, 86,244,
+	 20, 95,228, 86,249, 14, 66, 13,161, 68,153,126, 59, 56,146, 73,121,143,243,167,
+	230,106,203,205,114,207,247, 40,198, 15, 29,202,136, 45,127,115, 28, 27, 51,239,
+	 11,134,229,142,146, 62,  2, 82,164,218,234, 97, 72,217,191, 41, 22,177, 43,226,
+	143,146, 69, 31,179, 69,203, 25,113, 90, 59,191,197, 87,122,216,217,111,224,243,
+	 56, 25,236,221, 90, 11,152,178, 32,137, 64, 35,227, 64, 16,210,220, 77,  9,181,
+	165,220,115, 60, 12,206, 97,  9,251, 94, 65,178, 45,149,130,183,125, 65,212, 48,
+	242, 87, 43,106,174, 50,138, 27,122, 36,141,  8,237, 14,178, 28,143,217, 34,126,
+	221,185,223,216, 43,244,172, 77,241,171, 65,149,206,126,149,247, 30, 27,225, 96,
+	149, 95,145,107,  7,123,223,203,166,106,200,165,252, 93, 42, 57,126, 42, 76, 80,
+	143,226,103,197,169, 95,131,226,189, 56,108, 39,121,214,186,184,234,104,185,217,
+	135,220,115,163, 42,242,254,236, 73, 20,135, 79,103,125,193,  1, 94,121,186,207,
+	 63, 31, 62,136,134, 54,120,204,149, 98,120, 41,166, 72,116,215, 11,186,153,210,
+	159,157, 86,249,214, 90,141, 31,228,131,216,105,113,226,190,230,115,103, 26, 14,
+	  6, 61, 52,138,252,119,112, 56,184,204, 79,125,178,228,231, 26,150,106,246, 44,
+	193,163, 93, 24, 21,154,248,224,120,116,209, 70, 76, 11, 20,  7, 46, 80,191,239,
+	189,162,200,252,229,116,125,178, 59,212, 55, 63,  7,249, 21, 25,110,153, 45,158,
+	196,226, 62, 68,219, 58,213, 43, 37, 46, 57,217,181,235,147, 67,216, 47,142, 87,
+	205, 25,132,110, 12,136, 64, 52,117, 49,203,222, 87,203,188,149,160,114,107, 85,
+	  0,230,209,136,211,195, 46,184,222, 21,154,145, 57,156,217,158,  6,181, 46,101,
+	 54,115,156, 41,198, 81,  0,229, 98,172,190, 50,151,168, 52, 46, 56,173,197, 57,
+	 83, 27, 51, 44,111, 90, 16, 47,205,195,103, 29,141, 32,160,106, 68, 60,210, 12,
+	 90, 47,100, 32, 88,128, 50,154,125,153, 39, 27, 35,120, 79,248,254,178,  5, 28,
+	177, 86, 29, 87,209,175,186,  8,239,121, 37,128,168, 43,114, 68,108, 35,207, 85,
+	 56, 63,206, 56,169,212,186,191,189,180,163, 30,243,132,167,130, 26, 43, 91, 25,
+	255, 40,163,116,156, 48, 71, 96,142, 49, 79,197, 32, 13,193,111,158,209,123,204,
+	 47, 16,187, 99,197, 78,145,107,176,130,126,106, 23,239, 18, 25, 26, 24,213,186,
+	 27, 25,171,167,189,202,244, 38, 37, 83, 83,116, 63,116, 49,147, 10,117,234, 49,
+	254, 14, 95,134, 17, 30,225, 86, 91,183,157,186, 93,113,127,157, 76,138,220,206,
+	243,109,137,139, 22,179, 51, 73, 10, 12,156, 94,227,194,144, 58, 18,206,  5, 69,
+	158,214,216,253,232, 76,161,147,181,247, 91,189, 51, 78,175,142,120, 71,189,157,
+	  7,234,148,236,158,247,150, 86,239,221, 80,238, 63,179,144,246,243, 34, 38,  9,
+	 44,150, 88,141,158,203, 28, 73, 39, 38,213,142, 79,132, 59, 83, 74,245,194, 97,
+	 44,223,223,235,136, 58,193, 33,136,141,  9,189,211, 77,218,180,248, 54,194, 25,
+	132, 27,246,193,253, 89, 76, 90, 88,187, 81,221, 67, 96,162,103,107,123,252,205,
+	 10, 56,118,146, 31,129, 13,186, 95,121, 87,103, 30, 73,239,224,134, 58,208, 17,
+	203,167,242,147,106,197,244,133,103,249,237, 57,231,208, 59,101,124,222, 19, 40,
+	 56,145,  8,225,201,  6,248, 51, 15, 64,158,233,182,152,206, 60,158,115, 58, 49,
+	 49, 70, 31,109,178,222,  3,127, 81,154,234,105,187,143,231,223,100,244,168,112,
+	 57, 48,137,  9,  6,106,178,138,201, 11,154,246,116,227,243,210,240,217,129, 72,
+	 24, 31,116, 68,237,133, 33, 12,142, 88,137, 49,139,  4,230, 93,163,108,124,100,
+	149,196,192,236,197,156, 14, 95,214,222, 58,185,208, 16,104,234,144,240, 72,232,
+	197,202, 95, 72, 74, 63,249,160,138,172,113,234,173, 87,211,253,118,156,198, 56,
+	200,177, 11,193,159,139,240, 72,226,153,139,248, 34, 95,182,177,  0,207,145,  2,
+	 77, 96,210, 69,249,200,210, 45,216, 50, 23,159,149,241,175,110, 34,216,  3, 40,
+	205,  7,247,129,  1, 33,209,214,222,  6,186, 65,194,247,224, 15, 36,244, 66,  9,
+	 57,142, 29,199,149, 85,227,165,130,215,143,169,190,210, 20,172,236,  7, 49,131,
+	 54,132,216,130, 16, 27, 31,198,221,208,216,179, 61, 73, 78,235, 20,139,178, 55,
+	200,170,208, 91, 24, 16,244, 68,232,189, 71,129, 95,102, 19,213,144,113, 96, 34,
+	 65, 76,216,238,249, 59, 54,218, 15, 77,251,108,187,165, 35, 69, 17, 44,  9, 96,
+	 54,212,210,112,103, 37,203, 98,111,151, 46, 70, 62, 24,161, 75,201,160, 88,103,
+	 45,231, 39,109, 19,104,144,113, 32,178,253,239,120, 97,234, 98,  7,169,120, 56,
+	126, 81, 38, 88,246,196, 72,252,168,157,146,135,203,145,120,104,243,120, 94,234,
+	 33,243, 16,155,171,232, 12, 11, 55,  0, 49, 33, 73,205, 52, 81,174,200, 81, 18,
+	229, 69, 33, 11,111,120,116, 61,106,134,  8,197, 46, 68,246, 93,180, 49,248,197,
+	199,202,153,  9,223,136, 33,240,148,176,138, 66,181,  6, 96,149, 67,165,193,229,
+	195, 44,181,189,197,208,232,  9,203,194, 13,236,212,147,175, 14, 85, 76,202,163,
+	 42,196,212,145,253, 50, 21, 32, 87, 23,235,177,155,109,217,147,244,124,134,172,
+	181,226, 29,106,131, 33,151,150,123, 30,108,128, 92, 75,241,249, 82,223,236,122,
+	221, 33,202, 20,197,192, 96, 18, 49, 92,125,105,192, 95,246,168,111,184,182,219,
+	193,133, 98, 56,255,130, 37, 62, 66, 43, 82, 22, 56,114,241, 18,228, 60, 43, 84,
+	  4, 89, 23, 94,196,175,172,149, 77, 71,165,222,191,129,135,175,247,130,119,237,
+	209,192,159, 81,176,154, 34, 53, 77,196, 28,114,214,138,104, 49,207, 91,249,131,
+	122,155,163, 47, 88,127,154,182, 27,128, 39,202, 64, 95,253, 28, 83, 14,223, 54,
+	108,211,114, 10,168,168,203,251,176, 96,142, 92,220,128,173, 17, 75,234, 45, 11,
+	 79,118,160, 75,100,197,146, 99, 35,217,147, 99,202,249, 37, 75,191,209,204,233,
+	238,175,182, 17,149, 92, 99, 67, 34,  8, 36, 55,161, 86,135,  6,194, 78, 72,113,
+	104, 42,239,141, 79, 16,187,  8, 53,214, 71,143,100,164,174,167,  7,148,156,111,
+	 40,216,217, 29, 23,242, 59,225, 35,104,147, 55,106,208, 25, 10, 70,186,198,233,
+	193,176, 63,243,139, 70,147, 69, 91,188,133,235,167, 60,116,137,135,162,243,210,
+	134, 65,232, 79,152, 58, 44,114,  5,156,135, 91,167,170,225,122,134,144,  3,138,
+	223,215,231,163, 91,228, 42,191,110,233,142, 56, 47,151,  5, 14,198, 73, 82,246,
+	151,229,234, 97, 88,239,249, 35, 85,130,164,117,248,167, 32,  2, 11, 91, 51,239,
+	 41, 22,107,224,210,245,170, 97,  8,193, 17, 26,207,227, 16,  0, 14, 32,133,202,
+	167, 11, 33,165,198,154,163,240,167,134,165, 26,244,  9, 52,245, 88, 48,205,111,
+	165,103,180,135,173,154, 15,132, 86,  1,151, 16,183,251, 54,160, 68,224,231,229,
+	203,162,224, 42,109,141,179, 35,138,158,140,242,211,226, 39,122,156,164, 15,225,
+	 87, 36,124,162, 17, 80,155,155,216,133,  0, 94,100, 35,174, 74, 91, 89, 87, 40,
+	 13,217, 87,145,202,132,136, 85,148, 38, 33,114, 25, 59, 74, 82,168,108, 57,230,
+	201,122,171, 39, 50, 45, 66,144, 40, 28, 31,248,143, 62,137, 99,152,195, 69, 77,
+	 53,133,227, 44, 14, 97,101,239,239, 43,155,114, 80,191, 26, 29, 98,229, 91, 88,
+	144,186,145,253,210, 18, 10,208,187, 53,255, 81, 90,217,127, 49,254,151,106, 18,
+	 72, 34,105,166,185, 87, 13,252,201,219, 86,103,235,108, 95, 14,  8,160,161,247,
+	 71,152,113,179, 80,234,227,217,238, 18,198,190,197,130,219, 18,216, 88, 75, 79,
+	 39,104,222, 87, 82, 66,220,119,209,220,171,178, 99,207,129, 37, 77,122, 77,  1,
+	216, 74, 55, 59,168,212,186,190,194,122,200,252,139, 80,135, 60,169,252, 54,181,
+	 14, 27,177,234,167,137,231,195, 94,  6, 20, 39,161,228, 54,  3,232,240,106, 33,
+	231,253,124, 92,187,158,193, 81,128, 43,236, 64,133,180,175,150,240,133,  4, 60,
+	 96, 23, 70,201,  6, 54,180,132,212, 65,  7, 75,233,155,243, 12,148,217,138,235,
+	 55,120, 11, 36,165, 64,255, 59,171, 58, 30,  3, 92,204,194,186, 54,  9, 20,192,
+	 90,217, 19,222,252,203, 75,100, 23,137, 58,238,116,196,194, 70, 84, 23,230,195,
+	 56,175,183,145,236, 78,228, 77, 65,204,237, 96, 53,165,144,246, 57, 76,255,119,
+	180,220, 38, 88,177, 76,  0, 27, 29,207,162,  7,234, 78,197,158,126, 32,246,133,
+	147,192,107,100,244,210, 57, 69, 58,203,198, 68,136,  4,149,220,211, 60,199,183,
+	 84,114,246, 19, 10,109,248,232, 24,217,121, 13,229, 44, 83,149, 64, 63,150,205,
+	197,171, 46,120, 82,213,163,213, 42,154,108, 23,  1, 10,122, 17,120,187, 15,104,
+	191, 18,153,152, 29,234,207,199, 93,242,105,137, 98,106,210, 83,184,176, 63,153,
+	  3,192,181,164,127, 82, 79,154, 36,201,115,135,252,101,105,176,233,102, 74,178,
+	115,  9,159,196,  1,163, 99,195,160,249,155,  8,250,181,248,  3, 48,192, 10,144,
+	 18,  0,215,167,122,226,214,111,125, 22,  4,195,125,195,115, 24,124, 95, 32,244,
+	117,252, 86, 52, 47,206, 98,  5,167,172, 12,119,123,172, 14,115, 25,163,134,234,
+	126,200, 65,161,145,144,162, 62,210,192, 74,194, 29, 12, 16,248,211, 93, 86, 38,
+	 78,242,183,178,255, 58,122,233,196,140, 77,180, 60,112, 73, 86,127,195,194, 14,
+	195,212,176, 70, 24,148,218,209,211,192,119,238, 93, 98, 47, 13,118,  9,166, 24,
+	215,153,253,120, 55,227, 73,187, 98,170,236,185,224, 26,193,143,  3,240, 14,114,
+	 50, 38,112, 60, 98,148,219,195, 50, 36,150,115, 26, 89,179,153, 39,174, 54,102,
+	 20,198, 22, 82, 39,142,173,  3,183,114, 28,111, 59,231, 84,215, 98,122,252,251,
+	 13,174,115,114, 24,116,125,238,175, 70,147,191, 78, 69,159,108,203,208,137,181,
+	244, 53,249,103, 30, 24, 69,161,132,  6,180,157,160, 53, 46,236,  9, 52,210, 90,
+	220,250,143,206, 38,167, 79, 79, 65,108,  6,111,245,107,136,148,111,206, 37,222,
+	 23, 62,106,124, 76, 55,173, 97,198,185,109,236,106, 19, 17,126, 87,187,245,242,
+	111,227, 59, 20,198, 60,205,192,150,178,238,202,233,206,148, 23, 77,149,181,204,
+	 76,111,153,177, 92,171, 22, 94, 44, 77, 22, 50,159,133, 50,239,101,122,223,187,
+	 57, 82, 23,106,188, 13,251,159,  4,159, 93,125, 41,161,183,195,163, 42,129,111,
+	167, 89,181, 49,208,182,199, 76,235,121,106,111, 27,222,236, 20, 57,116,235,  8,
+	 11,255,255,109, 61,141,124,189, 52, 62, 43,  9, 67,  3,224,139,144,162, 31,206,
+	 88,145, 90,128,193,235, 92,203,122, 47,165, 38, 90,165, 77, 87,204, 72,216,  8,
+	222,100, 47,108,164, 41,133,  0,205, 39,235,201, 54,147, 80,200,228,180,218, 98,
+	 46,151, 95,255, 66,181, 15, 62,224,145,170, 79,174, 16,250, 23,100,201, 48,185,
+	146, 64,173,243, 83,  5,236, 97,187,133,246,135,209,160, 36,120,220, 44,196,193,
+	106,140, 90, 39,112,131,148,212,113, 31, 16,120, 66,219,114,167, 40, 52, 25,123,
+	 92,110,130, 84, 59, 14, 56,216,220,200,141, 26,243,102,247, 61,204,  9,161,215,
+	215, 63,188,162, 62,140,194,204,235, 45, 22,179,255,145,163,206,105, 56,149, 50,
+	181,  0,228,234,237, 70,115,200,179,197, 20,148,105,107,236,196, 45,193, 52, 10,
+	219,138,172, 70, 95,204, 59,  0,107,123,227, 32,246, 99,  8,239,253,130,191,122,
+	 13, 60, 71,129, 61, 61, 88,219,243,218,161, 58,232,165, 89,221,215, 80, 62,  7,
+	 28,127,238, 21,144,175, 19,196,210,  0,187, 96, 99, 41, 28,127, 31, 71,246,238,
+	 69, 74,167,148,176,195, 89,118, 59,188,165,247,244,176, 28,121, 41,232, 73,120,
+	140, 29,245,  5,112,207, 31,122,160,113,126,124,242,191, 23, 79,175,193, 53,189,
+	 46, 49, 88, 18, 35,187, 40,176,100, 86, 73,204, 16, 24,119, 32, 24,103, 84, 58,
+	 64,104, 25, 54,189,227,130,179,  6, 52,236,189, 71,238,210,141,210, 53,138,201,
+	 77,235,155,219, 76, 54, 60, 29,188,232,149,159, 80,191, 65, 73,  9, 10, 39,118,
+	 26,180,158,253, 44, 56, 64,  4,238,107, 99,  9, 84,119,236,245,100,125,220,194,
+	 81,154,109, 90,103,200,209,110,217,128,119,231,253,173,216, 42,  1,  4,146,125,
+	 19,111,119, 52,164,103,171,179, 58,240,159,154, 64, 42,243, 63,196,231, 43, 82,
+	107,105,207,238,224,207,110,170, 76, 16, 12,199, 89, 83,179, 59, 17, 51, 42,153,
+	222,136, 92, 99,195,106,  9,251,200, 26,151,228,180, 28, 77,105,149, 11, 84, 29,
+	 18,251,125, 60,149,144,200,180,248, 14,  8, 36, 90,206, 78, 60,138,164, 35,107,
+	 99, 20, 14,  6, 18, 52,229, 63,106,226,251, 49,158,111,180, 26,155,179, 44,135,
+	 12,  8,156,210,219,187, 87,223,233,104,178,212, 17,150,203,193,  8,130, 39,166,
+	155, 74,202,149,135,102, 57, 92,203,195, 65, 13, 29, 50,127,181, 44, 78,171,125,
+	209, 78, 29,236, 29,222,201,250,166,190, 18, 82, 10, 43, 29,207,241, 40,119,197,
+	242,128, 39,149, 28, 84,177,  5,179,170,  4, 59,190, 66, 57,146,178, 23,128, 85,
+	146,253, 68,243, 93,155,116,119,134,131, 73,114,253, 34,141,241, 49, 82,228,106,
+	 75,183,219,222,135,101, 75, 16,190, 71, 15,235,  5,188,124, 17, 49,239, 63,154,
+	240, 34, 30,179,199, 81,253,  8,150,110,147, 11,112,164,230, 69,231,124, 52,207,
+	244,106,246,123,255,212, 81,230, 63,194, 44, 73, 36, 72,190,187,124,200,152,133,
+	 49,119, 29,176, 75, 85,167,218,139,126, 62, 93,213,248, 86, 27, 79,224, 31,154,
+	169,104,238,221,139,209,204, 54,100, 59,171,224,132, 81,219, 59,122,199, 66,100,
+	 50, 49, 56, 62,241,220, 28,224, 40, 51, 73, 92,  2, 58,252, 72,  6,216,201,180,
+	129,188,217, 21,132,164,226,108, 53,229, 37,199, 72, 10,163,154, 52,161,215, 24,
+	227,220,150, 64, 61, 24,107,160,245, 14, 87, 29,229,249,241,251,201, 24,220,204,
+	254,178,214,211,124,229,199,150,208,220, 15, 42,227,206,123, 91, 60, 94,229,121,
+	127, 34,246,188, 27, 77,149,231,116,193,115,249,144,137,205,208,205, 84,197, 86,
+	 16,220,223,174,119,178,128,112,249,181,122,136, 17, 54,130, 70,227,197,137,209,
+	 52,237, 12,236,131,213, 41,250,236,146,198,239,128, 22,102,204, 73,137, 90,  7,
+	109,114,193,208,182,242,222, 90, 51, 57,250,206,235, 62,251,216,219, 72, 63,184,
+	117, 16,200, 13,  6,181, 15,175,176,  1, 80,191, 66, 69,134,231, 38, 20,159,210,
+	211,242, 41, 36,177,232, 71,214, 94,188,  4, 95, 20,202,236, 47, 10,131,160,228,
+	158,110,229,161, 28, 12,252, 56,205, 96, 25,205, 34,  4,140,205,108,174,  5,162,
+	154, 29,189,138, 72,242,  2,194,138, 98, 77, 18,123,235, 61,155,125,253, 87, 97,
+	255, 40, 84,  7,104, 64,225,157, 85,155,245,190,253, 21,233, 72,235,116,204,235,
+	107, 96,143,122,116,144,124,  0,250,190,219,211,121,249,163,124, 78, 14,  0,233,
+	 18,154,113,203,188,185, 57,175,  1,207, 56, 32, 11, 38,150, 32,211,138, 71,  4,
+	216,220, 76, 21,234,175, 15,143,186,154, 45, 78,105,127, 57,138,155, 88,119, 26,
+	102,232,108,127,134, 73,159,221, 60, 96, 85, 59, 95,248, 85,203, 73,163,179, 23,
+	238,118,143, 42, 78,252,181,165, 86,156,183,169,199,251, 15,150,105,158,158,233,
+	 72,140,222,155, 39, 15,238,138, 35,140,230, 93, 69,183,249,187, 98, 82,197, 18,
+	112,212,206,125,202,167,128, 74, 60,157, 46,202, 53,236,117, 52,136,206, 94,205,
+	 93,200, 68,216, 92,150,181,144,149,115,116,235,123,173,109,250, 93,148, 50, 54,
+	115,231, 89,  7, 26,200, 85,148,190,  8,103,214, 30,195,148, 38,249, 58, 30, 81,
+	104,183,177, 76,194,201,219,174, 91,  3,  0, 99,204, 44, 44,224,192, 30,255,175,
+	 99,195,228, 94,156, 45,211,139, 14,201, 27,235,241,177,194,201, 46,218, 30,192,
+	 65,109, 81,  9, 75, 92,203,224,107,254,213, 40,154, 30, 13,237,206,141,241,105,
+	117,246,142, 26,186,163,172,172, 44, 49,221,  2,119, 25,220,238,154,141,133, 19,
+	 62,181, 77,237,238,207, 26,183,175,170,181,132,196, 94,161, 15,252, 35, 76, 90,
+	193,163,169,138,152, 37,194, 69,  2, 85,150,112, 86,232, 39, 40,246,249,126,187,
+	229,134,237, 68,151, 61,119,218, 85,151,203,210,202,240,  3,253,231,112,203,120,
+	169, 61,100,174,168,237,142, 32, 29, 68, 97,140,156,158, 80,153, 31,232,167,118,
+	 10, 60,178, 23,241,253,101,152, 77,119,  3,168,210,186,  6, 77,115,111,163,229,
+	205, 44,  5, 55, 54, 86,101,165, 76, 26,195, 86,226,242, 93,169, 91,202,191,132,
+	123,255, 88,231,159, 49, 42,214, 17,151,157, 20,185,129,142, 65,145, 61,144,176,
+	205,172,226,233,251, 79,226,176,  8, 76,181,247, 36, 92,211,156, 87, 45, 25, 73,
+	 88, 61, 93,116,213,109, 51,241,222, 39,176,133,241, 48,  2,127,193, 89,244, 27,
+	181, 55,  5,173,167,142, 98, 77,160, 67, 27,133,233,  6,144, 53,118,236,  6,151,
+	 16,199, 34,105,116, 82, 70,203,229,215, 75,157,128,156, 20,252, 98,100,174, 38,
+	 22, 14,195,246,172,134,  0,231,147, 48,151, 83,209,220,170,170,120,118, 15,171,
+	133, 34, 77, 77, 96,174,220,147, 72,157,212,213,235,164,  1,110, 86, 43,174,221,
+	 69,196, 50, 48,189,197,201,219,104, 63, 35,230,194, 65,199, 87,174,248, 11,172,
+	  1,210,108,101, 20,142, 78,229, 18, 21,189,  2, 46,235, 39,134, 52,183,167, 25,
+	153, 31, 75,109,138,123,167, 58, 84, 28,140,162,140,  7,155, 82, 74,170,224,219,
+	 97,  7,107, 35,  4,114,210,180,182, 78, 19, 66,189,137,169, 21, 62, 22, 18,216,
+	191,105,135, 89, 66, 92,220,187,178,190, 67,100, 34,196,146, 61,124, 99,173, 27,
+	 65,124, 96,112,  4,130,253,246,148, 76,  7,254, 93,186, 51, 87, 97, 50,  7, 76,
+	198,251, 79,158,212,166,120,240,144, 38, 75,186,154,120, 98,114, 36,174,233, 93,
+	202,137, 24,192, 34,242, 51, 54,150, 82,114, 62, 99,191, 72,145,207, 36,141,121,
+	 28,151,  9, 24,155, 99,119, 78,206, 67,132, 64, 37,135,185,134, 16, 22,236, 65,
+	252,153,  9,141,250,251,  0, 37,158,210,122,119,  7,100,186,144,232,149, 10,  2,
+	 70, 90, 25,208,212, 93,166,139,106,147, 57,220,169, 12, 18, 96,255,233,186,182,
+	234, 46,255, 70,240,151, 99, 77,135,107, 92,246,162,188,110,  6,226,143,173,194,
+	 55,252, 13, 16, 22,237,130, 19,144,155, 18,  1,208, 12,114,145,166,  8, 19,112,
+	184,117, 36,100,155, 45, 11, 82, 28,249,123,171,151,134, 56, 72,242, 51,211,191,
+	198,219,222,223, 34, 20, 14, 24, 64,149,168,180,213,143, 32,107,  8,194, 30,123,
+	  3, 15, 61,121, 62,227,219,166,155,196,135,128,235,211,235,  1, 59,246,232,145,
+	 52, 87,235,234, 57,222, 16, 76,204,171,173, 28,169, 47,136,103,249,154,103, 14,
+	234,140,  2, 93,220,218,218,169, 38, 85,109,250, 61,  2,151,222,190,159, 73,189,
+	 35,164,221, 18, 51, 22,173,127,102,201,236,162,  3, 18,229,225, 99, 81,123, 87,
+	 31, 53,237,252,154,114,220,185,204, 19,210,163, 54,203, 29,155, 55,167, 11, 79,
+	 11,151,250,238, 33,  8,188, 57,239,194, 47,124,122, 58,171,  7, 35,215,111,222,
+	157,254,179,140,221,224,112,199,145,163,195,204, 46,150,  0,248,162,108,192, 92,
+	 54, 23,195,198,151,221,130, 83,169,108,229, 86,170,238,136, 70,235, 10, 84, 93,
+	 27,233,110,102,112,197,162, 18,244,123, 43,210,182, 81,118,180,  7, 16,228,149,
+	171,  8, 76,237,140, 19, 36,100, 64,211,218,199,254, 78,194,241,175,209, 14,249,
+	219,126,104, 83, 27,187,177,178,212, 11,241,206,107,173,180, 23, 46,166,159,138,
+	 16,169, 75,138,210, 97,252, 49,209,167,187, 58,132, 13,160, 85,245,180,160,116,
+	  0,191, 74, 68, 78,228, 61, 13,199, 87, 92,  5, 50,114, 31, 19,239,116,221,182,
+	211,183, 41,201,140,107,134,241, 14,106,140,185,236,246,167,216, 12,142,121,139,
+	198,234,166, 55,166, 53, 23,238,123,143,  8,181,246, 12,131,217, 90, 86,197,239,
+	177,244,250,228,  1,  5, 97, 80, 62, 62,100,175,178,146,131,165, 16, 47,206, 68,
+	160,207,198,246,225,225,181,105,  5,210,134,170, 51,159,238,182, 14,175,241, 21,
+	154,218,175,169,189,165, 35,193,197, 85, 15, 71,113,107, 53, 59,145,179,207,248,
+	197,173,137,108, 21, 97,195,187, 64, 20,246, 64,116, 83,241,222,110,102,134, 88,
+	158,224,188, 45,128, 99, 18,195,246,  3,100,142,123,179,139,213, 97, 11,200,123,
+	125,216,127, 74, 86,159,199,147,156,253, 51,249,207,184, 97, 62,206,204,150,254,
+	235, 23, 57,242, 83, 61,169,181,123,106, 59,118, 50,145,100,227, 20,106,187, 72,
+	162,219, 44,143,  2,109, 93, 89, 31, 36, 98,157,171,182,159,180,162, 35,228,151,
+	194,197,173,135,227,162,190, 64,167,203,237, 53,134, 20, 47,146,197, 55,158, 92,
+	125, 34, 52,142,116, 83, 15,184,118,177,243,218, 83,118,211,220,245, 53,242,148,
+	 28,225,164,245,163,  1, 93,244, 49,194,  5,105,129,174,166, 85, 64,106,  2, 98,
+	241, 49,237, 91, 27,116,  1, 60,125,109, 91,147, 26,132, 36, 46,125, 92,136,109,
+	 99, 36, 18,130,107,175, 65,186, 13,110, 55,171, 10,140, 19, 83,107,249, 53,157,
+	117, 24, 31, 14, 85, 61,171,215,120,112,231,112,178, 78,168,231,112,216,167,250,
+	  1, 38, 30,206,161,241, 80, 93, 53,153, 10,200, 80,106, 92,109, 26, 38,142, 69,
+	108,167, 78,123,198,  2,213, 56,112,244,228,211, 98,168,142,235,123, 26, 33, 86,
+	 57,126, 51, 10,127,203,122,111,190, 42, 58, 55, 48,215, 22, 27,172,118, 56, 61,
+	155, 16,104,135,170, 48,199, 74, 42,211,181, 90,168,113,  1,194, 29,134,241,145,
+	  0,159,227, 43,184,108,159, 40, 90,164,105, 43,133, 87,103,104,189,169,185,114,
+	121,126, 49, 54,227,124, 38,175, 73, 71, 19,163, 31,251, 48,239,252, 57,161,226,
+	245,233,234, 40, 73, 89,197,196,196, 27,240,116,212,254,148,102,102,126,222, 89,
+	191,125,202,182,139,224, 12,233,173,116, 95,202, 36,204,186,191, 73,215, 28,198,
+	 72, 26,109,250, 56,235, 28, 79,184,225, 32,255, 99, 67,156, 30,242,248,233,214,
+	 79,165, 51,  1,195, 88, 94,195, 22,208,106,124,233, 84,107,166,236,192, 38, 79,
+	180, 39,102,249,111,200,192,168, 99, 55,141, 20,135,191, 46,134, 26,144,106,108,
+	 69, 84,203, 56,142,238,210,156, 81,248, 21,135,228,240,115,134,142,223, 86,175,
+	143,141,160,136, 29,149,189,109, 17, 21, 12, 78, 51, 36,151,120,108, 89, 82,  7,
+	 73, 60,227,142,178,120, 65,117,188,215,238,167,178,197,134,111,115,146,255,114,
+	 70,230,251, 35, 34,232,  5,218,251,160,177,172,241, 21,213, 86, 69, 78, 65,198,
+	198,111, 12, 38,221, 83, 69,153,231,238,153,201,141, 21,117, 85,162,155,153,164,
+	246, 45, 48, 88,170,144, 22, 48,124,115,165,245,118,103, 59, 66,208,165,174,121,
+	170,239, 62,148, 89,149, 11,101,122,132,252,233, 23,108,208, 44,151,101, 57, 73,
+	173,217, 11,179,229,216,122,231,189, 29,246, 18,165,182,118, 28,130,210,134,140,
+	 74,115, 56,208,173,118, 70,114, 50, 11,116, 23,213, 10,143,214, 18,  5, 85,200,
+	 13, 21,116,134,103, 95,173,148, 42,189,221, 33,115,105, 22,  4,  4, 57,118, 13,
+	 95,168,147,153, 99, 75,132,244,139,248,170,196,223,  7,200, 19,131, 82,148,220,
+	124,236,215, 50,254, 10, 17, 34, 93,115,115, 52,175,115, 46,108,105,113,119, 77,
+	180, 22,131,228,204,144,164, 17,195, 52,149,230,106,203,182,207,236,139, 22,146,
+	240,132,122,229,229,249,113,238, 42,221, 31, 82, 40, 15,183,192,127,  1,164,157,
+	  5,112, 35, 22,233,129,148,202,  9, 58,219, 30,241,102,172,159, 33,237,137,161,
+	 25,100, 46,200,226, 38, 34, 16,151, 74,105,171,154,148,152, 23, 89, 79,146,169,
+	 61,144,241,165,217, 68,169, 94, 57, 35,192,179, 94,190,159,153,239,125,151, 41,
+	  8,240,206,120,171, 91,213,193,168, 90,132,  0,181,111,183,247,183,142,163, 23,
+	244,245, 53, 63,219,171, 53,250,192,119,241, 77,  1,238,103,  6,184, 81,211, 37,
+	253,108, 11, 71, 69, 70,182, 43, 88,215, 12,188,160, 85,123,154, 38, 89, 69,172,
+	241, 66, 22,138, 47,175,133, 90,179,167, 37,115,127, 64,204,106, 45,143,167, 95,
+	 89,158,147, 37, 15, 16,242,129, 28, 69,161, 87,188, 59,103, 55, 31,230,120,149,
+	169, 67,190,141,130,162, 44,177,204,105,253, 16,146,247, 41, 84,221, 26,103,167,
+	128,125, 73, 85, 26, 67, 58, 27,190,100, 28, 17,188,172,240,228,164,  2, 51,193,
+	201, 73, 57, 90,147,246,107, 40,202,110,190,157,213, 52,251,209,161,155,148,191,
+	169,163,214,222, 86, 79, 40,245,129, 16,117, 33,111, 58,248,187,215,200,178,235,
+	142, 55,174,168, 47,141, 33,168,158,174,197,182,152, 74,154, 69,148, 88,239,157,
+	148,119,216,115, 20,100,148,157, 62,255, 13,108,183, 33,181,218,  1, 65,169, 69,
+	 67,110, 70,192, 41,143,205,174, 69,111, 65,232, 92,194,211,222,242,110, 19,106,
+	222,111,221,132,228, 42, 63,173, 46,198,130,204, 98, 17,125,156,  2, 56, 32,200,
+	192, 59, 34,165,230, 71,196,132,158,107,111,131, 62,102,204,139, 85,  8,228,154,
+	 36,225, 66,107,210, 62,236, 80,151,143,210, 91,129, 15,189,125,122, 60, 13, 26,
+	 21,211,165, 49,252, 22,236, 96, 94, 72, 12,  3, 34,246,219,  0, 52,254, 53,220,
+	246,219,219, 87, 28,123,104, 57, 90, 75,120, 64, 83,136,135,102,103,130,202,254,
+	114, 82, 74, 56,149,225, 66, 38,203, 26,254, 96,237, 92,145,119,220,210,217,210,
+	 68, 10, 52,117,235,207, 81, 38, 87,192, 63,151, 28,123, 89,194,122,221,228, 75,
+	189, 48,177,109,  7,137,100, 34, 21, 14, 85,145,236,116,226, 97,130, 23,136,121,
+	230,166, 15,214,154, 54, 90,243, 56, 97, 68,231,118,150, 95,116,118,140,154, 42,
+	191,103,  8,170, 95,112,166,161, 90, 46,152, 78,201,137,225, 68,114,183,121,224,
+	230, 81,192,165,209, 62,144, 87,193,230,226,248,223, 36,241,131,194, 97, 38,116,
+	145,145,222, 96,168, 53, 97,  5, 71,108,153,112,184,199, 40,183,121,240, 90, 34,
+	133,219, 57,150,190,197, 10,202,  4,114,105, 27, 12, 23,162, 24,177,164, 92,253,
+	 14,169, 92,102,133, 64, 10,120,202,140,127,120, 15, 45,232,166,162,119, 90,177,
+	 34,225,168, 82,103,120,193,  3, 79,239, 88,147,187, 41,145,235,142,226, 12, 90,
+	151, 97,236,124,218,150, 31,249,215,137,158,221,151,116,  4,211,252, 83, 30, 65,
+	 85, 58,172, 25, 81,250, 35,179, 57,248,114, 35,185,105,141,103, 31,  0,151, 10,
+	 73,250,199, 23,212,101,  9, 19,219, 77,215,109,151, 23, 92, 21,149, 90,159,136,
+	162, 43,  4,182,111,220,234,137, 50,134,196, 47,196,115,119,128,131, 41,213, 31,
+	 43, 69, 47, 26,152, 86,113,207, 92,107, 66, 60,190, 50,136,210,175,228,234,254,
+	102,133,124, 75, 20, 92,222, 88,201, 17,134, 12,167, 28,  6,183,212,209, 52, 25,
+	153,  3,176,192,227,226,168,184,180, 61,146, 58, 58, 98, 52,155, 70, 75,108,117,
+	144,241,123,167,227,132, 22,136,  8,225,131,213,155, 30,206, 85, 96,107,180,234,
+	207,163, 92,211,105, 75, 24,211, 65, 62, 96,210,229,244, 23, 21,188,144, 95,186,
+	 91, 91,107,193, 27,111, 90, 94,246, 87, 99,207, 76,135, 21,169,183, 89,125, 19,
+	 70, 87, 23,157, 58, 49,196, 35,212,254,202, 28,101,153,100, 24, 31, 76,228,146,
+	106, 43,136, 81,243, 19,141,185,228, 36,243, 33,  1, 79,244,221,161, 59,188,248,
+	 43, 55, 29, 15,172,  6,128, 88, 42,246,184,169,105, 84,200,225,254,150, 41, 26,
+	 52, 37, 88,236,234,116, 13,122, 69,144, 34,115, 89,225,153,246, 76,144, 64, 99,
+	205,121, 13,231,190,136, 88,178, 40,100,230,160,252,237,250, 42,190,233, 85, 31,
+	187,112, 73,214,239,131,  9, 17,254,243,183,204,124,233, 79,  3,227,250,115, 91,
+	171,  8,246,191, 50, 78,  9,163, 85,218, 13,192,209, 62, 94,174,  2,174,117,  6,
+	149,  0, 70,177,100,211,  5,120,198,223, 58, 27,221,191, 67, 21, 95,111,151,164,
+	172,  2,137, 28,173,140,250,209,196,160,151, 90, 18, 28, 62,200, 60, 43,132,139,
+	 10, 72,164,198,167,100, 18, 48,110,156,230,145,188, 24, 11,202,203,243,217,146,
+	247,217,112,174, 50,  7,159,158,162,122,145,174, 51,156,153,170,148,158,220,146,
+	177, 37,172,166,235,137, 43,200,143, 21,133, 11,209,219, 41,237, 74, 79, 38,113,
+	 67,127,231,110, 83,128,226,123,163, 29,132,182,  8,121, 66,216, 50,118,162,185,
+	  9,133,232,160, 71,178, 37, 75, 60, 68, 75,145,163, 13, 72,170,230,222, 18,133,
+	  5,222, 52,100, 64,161,221, 76, 32,  3, 43,107, 88,220,107,183, 45, 18,184,211,
+	 62,166,205,169, 95, 35,245, 57,197,101,141,190,214,197, 67,202, 38,252,218,158,
+	 18,243, 96,  4,223,254, 87,  3, 51,224,148,157, 44, 68,156,161, 47, 67, 96,192,
+	238,173, 19, 33, 90,205, 29,251,158, 54, 17,160, 19, 18, 64,112,111,121,113,239,
+	195,170,211,180,233, 72,118,240, 45,240, 59,176,161,  3,226,126,235, 25,221,100,
+	 90,131,190,124,197,135,189, 68,130,255,255,217,254,206,165,213, 99, 38,  0,107,
+	 52, 88, 89,205, 60,102,178, 29,216,201,246,102,231,255,  3,219,243,106,142, 33,
+	233, 31,123, 88,124,249,250,119,217,156, 66,120,114, 17, 23, 96,250, 42,251,244,
+	 98,158,183,208,161, 75,226, 50, 62,150,158,136,166, 89,  3,  1,164, 64,253, 78,
+	 98, 47,105, 41,246,112,115, 83, 14,147,199, 27,123,155, 76, 35,241, 39,107,110,
+	 26,105,235, 38,132, 15,118,197, 24,  7,202,254, 19,122,231,199,232,181,173, 79,
+	234, 91,228,196, 72,173,141, 99,146,111, 60,140, 58,219,146, 43,204,183, 89,105,
+	 52, 46,247,106, 69, 15, 48,103,248, 57, 69,213,188,  3,174, 85,172,189,111,206,
+	193,214, 98, 25,155,132,105, 13,162, 66, 40, 81,113,121,160,222, 45, 43, 60,170,
+	234, 34,147, 28,143,196,170, 83, 46,196,135,104, 59, 58,  3, 75,232, 36, 38,128,
+	244,246,116,190,116, 76,118, 59,116, 28,123, 40,118,226,117,172,  6,220,252,240,
+	 53,158, 20, 29, 16,141, 66,111,  6,174, 24,250, 69,104, 24,172,252, 98,142,114,
+	100,236,183,253,185, 52, 39, 76,238,150,186,154,251,155, 15,138, 61,204,234, 65,
+	147, 91,205,142, 36,144,130, 86,185,141,  9,160,123,124,212,209,180,194,203,216,
+	 45, 52, 44,159, 72, 92, 65,117,206,158, 53,  4, 81,109,  6,201,241,135,  4,193,
+	 38,221,111,117, 52, 88, 18, 96,109, 23, 77,201, 44,135,105,200, 16, 45,105,255,
+	139,171,181,208,121,178,139,232, 71,147,  7, 77,157,250, 80,247,153, 96,138, 56,
+	196, 49, 72,201,162,219,151,176,147, 61,116,154,164,198, 75, 89,  5, 53,127,240,
+	200,219, 91,113,203,214, 82, 90,172, 58,145,  8, 52, 37, 96,103,188,179,126,164,
+	  1,182,213,189,152, 41, 66,227,235,202,246,227,122, 67,186,  7,175, 95,180,108,
+	 88, 95,156,235,141,184, 46, 27, 53,243,247, 34, 84, 49, 16,173,195,107,254, 88,
+	178,246,193, 75,225, 47,128,115,164,113, 97,  9, 67,180,139, 96,217, 35,223, 81,
+	121, 89,189, 12,251,181,  2, 94,234,194, 20, 22,110, 69, 60,210,120,175,141, 45,
+	 33, 51,206,132, 72,102,125,171,214,156,  4,210,  3,119,255,225,  8, 15,147,131,
+	 87,198, 20,  1,197,229,115,189, 23,215, 45,233, 37, 78,195, 38, 76,177,187, 80,
+	 56,123,  9,104, 52, 45, 44, 76, 49, 23,121, 48,168,169,230, 21,  5, 93, 83, 42,
+	224,134, 31, 63,163,124,211,198, 52,109,221,150,124,188,167, 61, 46, 26,185,242,
+	105, 33,195,137, 62, 58, 75,247, 51, 41,242,164, 43,220,115,190,253,227,201,101,
+	187,181, 48,169, 71,  2, 23, 72, 21,125, 45,  3,132, 60, 53,179,159,150,241,110,
+	 49,151, 38,126,110,203,147,166,226,211,144,115, 43, 73, 43,189,  2,254, 31,241,
+	166,150,101,252,211, 99,130,231, 72,150,110, 96, 27,250,194, 21,122,210,133,141,
+	 86,141,226, 76,239, 55,103,159, 53,194, 88,130, 91,124,128, 89, 83,178,252,215,
+	 84, 20, 24,183, 85,236,208,179, 74, 21, 86, 94,195,242,189, 36, 86, 69, 22,101,
+	 33,154,100,114,118, 22, 89,164,137,244,108,200,125,119,199, 53, 69, 27,114,127,
+	173,155, 47,  2,237,132,222, 23,130,193,206,247,235,236, 11, 23,124, 12, 79,246,
+	216,111,225, 83,220, 43,173,218,244, 12,238,  9,122,238, 35,140,118, 36,171,198,
+	 69, 79, 62,  0,179, 93,219, 53,202,242, 10, 29, 85,121,210,121,246,153,139,151,
+	 77, 35, 71,136, 21, 13,233,167,117,200,250,180,246,149,231, 55, 31,115,169,249,
+	139, 77,235,123,108,240,247,157, 44,155,164, 77, 95, 87,109,179,106,196,141,196,
+	143, 92,111,  8, 49, 84,108,105,177, 72, 84, 30,119, 24,192,162, 66,189,144, 29,
+	107,173,153,223, 97, 72,120,178, 65,233,156,250,128,209,146,228,  7, 95,149,232,
+	  3, 34,111, 27, 58,188,130,239,204,157,220,123,  0, 36,141, 19, 91,237,133, 55,
+	 89, 12, 83,220, 73,129,223,187,160, 18,199, 65, 39, 69,141, 81, 90,193,133, 31,
+	234, 84,105, 68,  8,136,184,124,170, 30, 88, 97, 19,181,  2,  8, 25,243, 90, 83,
+	246, 36,219,188,210, 42,142,102,210,108,145,238, 66,179, 36,139,120,250, 94,234,
+	 70,211, 12, 18,183,100,113,244,159, 45,187,156,  6, 85,250,217,  7, 53,217, 17,
+	  5,110,251, 90,109,155,111,224,172,191,183,228,115,174,152, 47,175, 53, 48,218,
+	234, 22,163,139,202, 39, 68, 29,146,207,204, 90,172,148,182,149, 71,195, 76, 60,
+	251,122,150, 21,177,241, 83,225,127, 74,244,254, 78,142,147, 12, 30,174, 21, 16,
+	 67,193,117, 78,246,108, 86, 35, 57,178, 92, 38,152,223,115,196,121, 16, 26,134,
+	176, 52,238,207, 46, 69,109,178,178,214,129,182,170, 24,188,177,  1, 52,147, 84,
+	232, 95,145,  0,136, 72,126,252, 58,208,111,151,126, 23, 93,111,145,226,179, 18,
+	 73, 54,175,112,133, 98,151, 16,  6, 97, 74, 14, 24, 98,233, 20, 46, 32, 58,143,
+	100,175,180, 19,144,112,196,208, 58,176,190,107,231, 37, 32,242,235,245,228, 77,
+	120, 88,208,211,231,  7,236,169,220,  2, 49,141,  4, 63, 63,  2, 93,139, 79,183,
+	 83,224,110,193,199, 13,176,232,197,227,129, 75,143, 76, 58,  1,136, 78,193, 45,
+	218,147,117,127,  4,227,161,138,  9, 30, 86,116,206, 28, 35,234,  5,220,170, 26,
+	105,215,168,118, 77,192,124,206,205,100,226,164,177, 16, 21, 61,252,101,130, 75,
+	203,146,236, 55,  4,182,204, 45,165, 76, 88, 68, 30, 46,254,224, 78,231,151,155,
+	 92,138,202, 15,232,192, 78,118, 36,121,110,190,121,127,153,253,110, 69,237,201,
+	239,150,105, 33,251, 25, 14,189,163,241, 38,231,183,169,204,232,240,155,215, 25,
+	106,107,172,214,145, 37,240,235,173,134,135, 79,116, 36,162,227, 52, 43,187,241,
+	 60,  8,160,206, 85, 34, 90,154, 33,105,114,235, 88,224, 55,109,206,248,224,111,
+	173,201,168,165,146, 99, 63, 11,207,139,191, 35,207,204, 86,179, 73,224, 62,118,
+	220,107,188,223, 26, 52,200,118,196,179,205,  3,214,129, 48,132, 18,249,119,182,
+	 99,147, 54, 91,155,104, 51, 33,186,159, 24,164,137,173,153,202,133, 87,131, 42,
+	 60,217,144, 66, 39,205,253, 33,200,146, 49, 79,115, 47,  4, 58, 84,122,251,138,
+	242, 41, 57,136,175,143, 50,246,240,122, 86,209,155, 89, 93, 80, 53,125,180, 59,
+	 49,240,  9,232,129, 21,186,161,189, 76,135, 86,226,249,103, 98,161, 27, 82, 67,
+	 61, 55,234,148, 14, 80,249, 35, 29,124, 28, 80,  5, 33, 93,244, 67,185,207,246,
+	 72, 17, 83,  8, 92,215, 76,207,184, 88, 36, 31, 41,181,251,105, 22, 18,105,228,
+	 60, 30, 44,204,152,245,136,112,108,234,163,112,133, 11, 33,163,177,  9,  3,177,
+	 36,125,163, 14, 92,122,111, 90, 36,104, 28,180, 60, 24, 64,247, 39,134, 55, 73,
+	255, 61,176,154,209, 51, 90, 66,120,175, 59, 23,247, 52, 22,154,240,186,185,217,
+	149,122,195,105, 83,104,108,218, 78, 17,209, 24,218,120, 74, 64, 91, 42, 66, 14,
+	 56, 34, 66,217,144, 95,  2,219,225,246,228,181, 82,210, 93,202, 61, 86,137,  2,
+	 23,207,183,176,192,134,191,104, 16,118,163,240, 47, 72,205,115,236,133,  0,157,
+	 60,110, 74,198, 92,212, 35,150,148,114,188, 52,157,181, 60,143, 15,234, 58, 70,
+	120, 41, 13,105, 24,232,  6, 34,254,221, 40, 11,220,225,174, 10, 92,133,  0, 15,
+	213,109, 27,119, 34, 94, 58,  3,222,234,166, 85,205,222,182,168,133,224, 81,156,
+	 63, 78,125,199, 78, 70,112,218,214,140, 53,238, 24, 16,105,108,183, 22,102,215,
+	151,154, 98,206,115,215,  5, 68,238,109,148, 46, 33,235,110, 19, 67,166,226,101,
+	 84,148,103, 72,176,122,212, 33,184, 71, 26,158,138,106,211,167,213,160,247, 92,
+	 58,182,247,250,197, 52,234,115,141,192,215, 23,104, 88, 12,179, 62,247, 29,148,
+	 26, 77,182, 32,  1,134,  7, 68,102,152,195, 56, 97,224, 26,237,115, 43,129, 18,
+	 53,222, 38,218,130,156, 95,156,219,242,132, 35,228,200,178, 79,144,207, 84,161,
+	112,183,115,169,228,141,148, 78,178, 80,214,233, 38, 30,163,254,127,115, 54,105,
+	 75, 25,193, 65, 71,234, 27,247,209, 24, 12, 82,198,250, 39, 54,112, 14,  3,167,
+	118,234,252, 11,220,101,140,127,180,255,  7,246,  0, 33,104,110,108,141, 80,104,
+	126, 99,119, 73,167,236, 90,166, 74, 15, 90,239,174,227,152, 28, 22, 28, 37,102,
+	157, 20,176,247,198, 55, 84, 31,254,239,227,  5,229,204, 94,126,178,111,132,226,
+	 64, 18,104,161,100,184,175,151, 36,  6,160,155,247,175,117,114,145,246,188,162,
+	248, 57,234, 12, 61,193, 82,182, 76,231,213, 31,162,178,235,176, 85,113,248,110,
+	 21,251,232,208,  2,223,151,203, 62, 63, 31,107, 99,  5,201, 33, 79,193,191,127,
+	254,119,217, 47,163,169, 25,213,213,141, 54,115, 52,  4,161,216,203,172,192,230,
+	151, 40,  4, 30,111,115,250, 28, 37,218,185,155,166,198,223,159, 45,190, 97,107,
+	 40,128, 17,225,237, 48,139,128, 63, 85,  3,247,182,202,172,154,  9,101, 56,114,
+	 51,136, 81,213, 67, 67, 34,116,230,193,254,151, 31,192,  9,145,134,146,206,183,
+	222,  3,116,163,138,230,255,244,232, 16, 10,243, 30,120,101,101,255,172, 73,223,
+	113,188,148,223, 80,137,145,169,196,217, 85,111, 85,172,182, 52,118,197, 81, 63,
+	247,178, 36, 21, 86, 83, 28,182,176,246,134,148,167,162, 34,204,232, 84,230,237,
+	131,231,117, 69,111, 52,194,146,140,143, 27,195, 62,209,140,160,130,113,241,223,
+	110,216, 49, 67, 83,199, 52,169, 57, 77, 95,158,242, 12,167,132, 60, 86,169, 77,
+	249, 47,246,219, 45,  6,255,254, 94, 13,210, 60,249,146,201, 67, 66, 65, 89,  0,
+	124, 43,192,189,108, 69,176, 16, 74, 77,216,255,241,176,207,150,200, 21,164,248,
+	153, 85,255, 99, 47,201,134,159,131, 49,135,181,157, 15,177,201, 13,136,221,195,
+	132, 39,190,  6, 47,233, 81,237,139, 26,  8,238, 37,107,248,139,225, 79,183,218,
+	185, 44,160, 60, 30, 88, 88,119,234,234, 71,246,118, 15,103,184, 52, 70,250,  1,
+	202,242,197,118, 98,158,204, 62, 80,134,125, 58,221, 92,155,125, 87, 28,187,207,
+	 92, 38,174, 97,173,107, 51,220,248,203, 61,145, 16, 75, 99,182, 47,127,235,159,
+	  7,219,115, 20,141, 39,235,121,137,187,135,192, 88,231,226, 70,231,144,192,155,
+	 32, 47, 45, 98, 41,  8,172, 97,172,179,238, 49, 54, 73, 24, 32,171,119, 16, 70,
+	 51, 41, 96,255,117, 56,  7,174,195,239, 67,255,145,212,157,193,  8,217,218, 75,
+	203,175,189, 50,233, 39,  5,184,241,172,200, 58, 22,152,129,157,241,174, 15,245,
+	 41,247, 76,176,204, 40,245,152,  1,  3,231,  0,146,237, 21, 89,173,151,193,158,
+	127, 84,187,234, 66, 63,243,233,229, 69,188,219, 66,207, 64,188, 79,134, 26, 83,
+	 33, 66, 89, 35,207, 85, 13,195,222,126,183,248, 17,251,213,120,217,210,174, 87,
+	254, 17, 99, 86,201,121, 64,239, 27,233,224,153, 52, 51,197,232,222,101, 83,191,
+	150, 60, 16,130,187, 47,160,252,165, 27,137,149,197, 99, 90, 40,141,158,160, 69,
+	 87,122,230,142,153,108,225,108,134, 78,  6, 97, 33,208,140, 20,  5,231, 37,119,
+	184,234,169,163,215,113, 76, 92,186,164,159, 75,  4,247,  4, 98, 32,125,168,133,
+	178,164,233, 84, 44,162,  7, 23, 19, 19, 27, 72,237, 10, 11,212,217,214, 36, 89,
+	 78,219, 47,230, 63,127,201, 59, 10,159, 26,207, 50,158, 20,  6,  9, 51,236,114,
+	165,223,226, 25,  0, 49, 97,112,226,238, 78, 36, 65,107,130,212,213, 69,162,161,
+	105, 82,202,  3, 41,163,190,191,  5, 47,234,226,155, 10,101,123,179, 97,207,177,
+	110,135, 78, 65, 34,252,253,  6,191, 60,239,126,189,151,156,166, 47, 27, 33,205,
+	189,238,139,171, 17, 82, 52,125, 47,217,152, 56, 75, 25,  6,116,203,168, 29,151,
+	184,203,190, 73,128,214, 66, 87,236,149,102, 49, 23,216,129, 36, 35,119,148,113,
+	 89,136, 87,206,139,123, 54, 42,199,124,163,155, 48, 58,196,240, 89, 65,185,  9,
+	252,204,104,118, 22,150, 19,145,127, 18, 10, 50,140,216,218,180,246, 19, 21,216,
+	121,187,188,199, 41,202,108,187, 68,233, 54,224, 38,121,254, 65,154,183,104,164,
+	231,178, 77, 33,153,133,220, 51,148, 79,223,105,198,185,111,142,146,220, 91,212,
+	229,  1,117,209,157,238,157,204, 18, 67,196, 40,234, 86, 34,240,169, 35,108,134,
+	226,147, 78, 33,254,167,121, 59,218, 95,236,254,133, 18,206, 52, 58,225,251, 74,
+	156,163,160, 19, 27, 69, 29, 23, 22,213,132, 71,137,225, 84,177, 12, 74,152,210,
+	223, 40,136,199,230,121,184,133,163,116,162,227,191,146, 34, 36,212,205, 39,146,
+	118, 40,252, 13,102, 72,240,152, 19,207,153,238,114,134,205,149, 67, 38,145,157,
+	 24,215,224,203,226,218,208,140, 57,128,196, 52,117, 26, 41,168, 61, 52,249,163,
+	107,244,149,230,242,232, 24, 57, 88,209,172, 91,229, 86, 72,112, 66, 87,  8,250,
+	202,141,188, 92, 83,213,179,101,246,232,177,165,  7,157,118,166, 71,110, 99,107,
+	254,218,167, 28,138, 22,216,163, 34,192,105,128, 14, 79,163, 51, 47,130, 29,103,
+	254, 39, 19, 46,102, 65, 60, 65,  0,118,187, 52, 54, 11,144, 51,159, 85, 79,182,
+	248,141, 50,182,196, 84,235, 41,252,209,110,  6,219, 42, 31, 11,140,169, 13,109,
+	169,158,167,196, 30, 21,168, 10,234, 98, 39,101,230,  7,255, 10,183, 97, 47,177,
+	 29,209,129,211,129,180,204,165,193,127, 31, 54,192,180, 92, 36, 47,121,240,166,
+	102, 67,102, 63,121, 37,152,217,124,210,179, 24,189, 97, 91,211,160,149, 63, 25,
+	 36,160,199,167,249, 67, 18,115,111, 41,139,251,245,  2,160, 76,174,144,241, 37,
+	 49,180,236,227, 90,117,146, 91, 93,197,132,133,143,  4,157, 12,232,112,122,136,
+	251, 13,203,  2,209,  8,165, 31,181,252, 42,112,117, 72,145, 88,130,120,121, 91,
+	  1, 39,239,215,234, 71, 95,211, 10,147,250,196,242,167,161,240, 64,233,201,203,
+	143, 94,149,236,159, 43,151,200, 82,101, 19,227, 25,232,174,181, 90,129, 64,208,
+	162, 19, 68,140,134,136,253,121,221, 60,143,128, 14, 85,222,155,223,125,122,183,
+	  3,233, 94,201,231,  6,220,115, 25,184,186,179,136,227,142,227,  3, 65,155, 40,
+	249, 31,113, 72,  5, 26, 33, 57, 38,124,193,133,106,219,236, 57,207, 91,110,144,
+	103, 46, 53,104,  5, 99,194,195,119,241,227,146,150,205, 14, 34, 40,  1, 20, 37,
+	 89, 82, 60,234,116,133, 91,211,206,254, 45, 42, 83,109, 82, 40,250,253,219,140,
+	186,115,241,179,239,153,109,175, 20, 43, 65,  2,153,244, 98, 51,208,  5,173,228,
+	231,164,229,151, 39,117, 25,203,212, 20, 22,179, 47,212,137,124, 41,194,104,194,
+	196,  5,214,  5,222,131,  0,147,  5,121,184,130,212, 98, 35, 78,208, 43,166,147,
+	233,218,121, 83, 72,223,116,110,215,150, 85,186,203,146,239,166,133,150, 17, 64,
+	 60, 24,190, 64, 16,152, 98,127,156, 51,169,177,213,239,126,175,233,111,215, 34,
+	 95, 76,148,101,210, 73, 93,213,167,122,128, 64,230, 82,150,231, 92,153,  5,131,
+	223, 91, 96,203,171, 92,176,125, 81,115,145,131,219,209,195, 20,156,112,213,109,
+	158,126, 24,135,192,248, 39,206,227, 50,200, 40,112,121,182, 34, 15,123,152,147,
+	237,121,109, 62,110,200, 12,207, 23,217, 11, 85,192, 21,224, 77, 45,136,194, 23,
+	163,239, 52,195, 65, 73,216,210, 80, 65,140,221,164,119,107, 72, 71,203, 74,245,
+	243,225, 83,236,140,143,218,150,204,115, 29, 90, 95, 31, 42, 50,197, 10, 34,198,
+	103,  4,247,142,232,233, 49,180, 26, 56, 14,  9, 54,206, 26,146,195,138,164, 99,
+	222,182,112,151,166, 72,103,215, 60, 74,248,255, 39,246,112,  1,254, 26,194,109,
+	152,249, 27,114,106,218, 33,206,117, 81, 69,202, 41,241,108, 21,207,218,113,229,
+	 36,128,234,246, 84,175,170,128,  7,249, 92,221, 23,187,203,117,111,230, 54, 11,
+	 87, 63, 62,158,247, 78,115,190,254, 57,138,  4,220,120,235,203, 73,104,108,105,
+	 25, 65, 54, 75, 30,191,225,239,205, 15,164,138,236, 11,207, 69, 36,121, 48, 27,
+	 83,106,137,150, 65,105, 93,188, 23,148, 17, 68,218, 93, 23,254, 83, 60,101, 38,
+	180,200, 53,233,248, 63, 83,177,229,175,178,148,168,  6,217,111, 29,122, 63, 60,
+	166,170, 59,211,235, 33,210,215, 18,169, 91,196, 46, 81, 47,185,112, 18, 73,  0,
+	213,165,251,106,218, 62, 62,156, 72,254, 97,142,167,126,164, 25, 17, 89, 87,107,
+	131, 40,199,171,219, 92, 43,239,195,205, 40,236,143, 45,218,183, 15, 22,160, 89,
+	109, 23,184,  6,132,107, 81,242,113,123,172, 95, 61,101, 76, 30, 68,222,235,118,
+	134, 25, 47,101,  2,  0,232, 16,118,183,178,150,151, 36,207,254,182,188,129,241,
+	 92, 54,242, 65, 99,107,166, 37,222, 39,  0,131, 44, 40,181,104,244, 81,122,212,
+	 89, 18,173, 79, 92,171, 91,172,237,185,206,255,246, 21,100,115,142,169,103, 66,
+	131, 26,188,217,185,140, 52,160,124, 65,141,181,100, 37,195,252,183, 39, 90, 58,
+	195,147,250, 64,133, 98,123,152, 75,177,151,173,  4,190,136,237,187,211, 95,100,
+	181,238,105, 43, 28,243,206, 36,175,248,236,246,121, 32,184,  2, 13,183,236, 64,
+	 55,195, 14,249, 42, 63, 78, 67,232, 43,237,116, 44,200, 28,161, 60, 65,247,183,
+	186,187,175,171,208, 25,186,176, 20,174,236,  2,247,213,151,185,  2,142, 23,250,
+	 98,186, 49,229,187, 37, 30,221,189, 21,116,251, 13, 55,133,108, 51, 13,240,135,
+	250,215, 26,253,168,108, 28,215, 23,234, 88,143,230,109,115,117,230, 35,212,120,
+	 77,249,155,236,237, 99, 42,144, 85, 98,241,204,248,129, 16,243,250,209, 93,160,
+	215, 60,224,222,  8,221,247,198,159, 82,173,167,103,143,137,175, 43,  5, 30,164,
+	 55,102, 15,246,127, 91, 44, 56,122,133, 14,134,174, 21,238,149, 44,136,241, 42,
+	217,102,121, 89, 44, 24,204, 12,168,114,222,221,142,173, 45,249,222,193,165,151,
+	 42, 72,133,218,110, 67, 33, 98, 36,244, 41,201,111,181, 51,253,121,188, 35,112,
+	115,117,221, 25,  8,187, 29,193, 92,118,156, 93, 16,132, 46, 99, 90,  8,109,170,
+	104,129,219,163,231,168,158, 87, 30,212,144, 74,198,136, 86,  7,111,242, 15, 55,
+	 40,197,253,148, 87,108,105,234,217,191, 12,223,155,197,103,117,171, 80, 27,206,
+	 14,162, 97, 53,135,213, 72,211,162,168,202,  1, 19, 37,  0,132,188,199,102, 94,
+	 65,205,242,  4,150,124,244,176, 78, 84, 42,208,159,231,165, 96,198,214,188,149,
+	 54, 97,127,132,168,193,208,118,158, 53,  2, 58,215,228, 38, 42,110, 97,140,239,
+	182,219, 84, 26, 48,  3,120, 73, 56,169, 38,204,253,144,178, 96,176, 54, 42, 39,
+	 47, 53,120,116,210,181,243, 31, 14, 97,253,208, 12,  4,240, 50,216,219,118,170,
+	164, 61,161, 25,213, 31,188,180, 98, 68,  6,236,225,167,112, 71, 64, 59, 37,140,
+	192,221,119, 89,213, 74, 45, 86,147,193,154,253,160,136, 41,171,156, 84, 96, 96,
+	238,251,102,199, 71,242, 32,144,197, 50,254,116,210,155, 59,230,242,220,121, 38,
+	231,  8,122, 48,215,146,251,194,248,  2, 37,234, 17,144,194,200,242,229,239, 42,
+	116,238, 79,179,212,202, 82, 77, 59, 57,207,166,184,162,144, 23,204,184,184, 35,
+	216,177,  4,143, 78,158, 89,182,119,166,179,131,237,135,174,158,168,106,109, 70,
+	 96,231,  6,254,131,151,138, 16,189, 31,  2,248,133,  5,234, 50, 10,248, 96, 26,
+	116,183,175,143,169, 67,143,156,248, 89, 98, 96,185, 85,250,169, 27,117, 51, 72,
+	189,151,177, 37, 42,150, 45,131,132,116,224,221,118, 25,182, 14,171,125,253, 63,
+	144,108,231,177, 49,112, 90,137, 28,132,145,119,174,132, 89,130,225,249,  5, 14,
+	 50,189,230, 83,224,241, 40, 90, 13,196,130, 12,229, 81, 50,136,124,191,118,  2,
+	211,132, 73,242,101, 10,151, 59,205,178,255,200,219,122,132,180,186, 45, 92,157,
+	 22,149, 59, 55, 69,210, 38, 59, 85, 78, 10, 33,149, 94, 90, 13,107,255,210, 11,
+	221,  4, 54,214, 45, 50,119, 99,190, 51, 94,184,173,146,217,  8,197,180,131,138,
+	234,178, 76, 88,110,123,235,250,110, 77,139,  4,202, 48,183,123,250,  1,179,176,
+	 93,146,255, 57, 62,178,152, 65, 32, 33, 40,122,190, 41,101,191,198,218,151, 39,
+	147,232,101,137,242,199, 47, 52,134,151,248,167, 27,117, 93, 81,127,165, 10,189,
+	158, 84, 83,202,240,240,227,200,112,185,178,185,165, 38,  9,197,247,190, 54,189,
+	169,  8,100,181, 26, 86,211,196, 58, 50,214,235,212, 97, 58, 33, 55, 54,234, 62,
+	220,123, 92,104,228,143,250,164,199, 18, 77,212,185, 79,176,152,120,221,  2,150,
+	183,254,134, 27, 45,120, 27,248,211, 52,107,188, 68, 90,119,170,141,255,197,155,
+	172, 22,156,176, 36, 22,229, 61, 69, 86,222, 63, 67, 73,234,232,218,116,214,  1,
+	 84, 96,161,131,186,252,236,157, 89,180,102, 19,180,203,236, 61, 53, 18,155, 26,
+	 43,211,111,186, 36,183,105,225,220,194, 71,150,134,246,  3,140,124,244,234, 82,
+	 54, 20, 14, 28,173,190,165,210, 46,128,226,145,228, 70,216,127,125, 45,241, 99,
+	 12,184,214,234,236,185,128, 91, 18, 55,214,157, 88, 29,121,190,186,111,129,201,
+	215, 75, 94,138,250,157,107, 81,144, 84,136,145,123,151,209, 35,191,235, 26, 74,
+	 40,255,118, 91, 45, 10,213,237,187,113,  6, 47,241,149,178,183, 34,205,204,124,
+	160, 96,193, 95,102, 96,108,177,204,241, 79,247,151,250,174, 77, 78, 63,190,213,
+	 38,205,210,201,166, 84,220,159,242, 32,161, 65,237, 29,139, 37,183, 95,105,237,
+	 38,158, 17,234,180,187,  0,115, 31, 17, 75,176, 16,120,183, 53,160,212, 35,196,
+	217,128,188,  0,122,254,216,164,  3,117,199,212,247,190, 53,101,233, 67, 89,158,
+	225, 78,136,161,230,161, 59, 15,175,189,119,182,232,211, 18, 55,116, 13,178,201,
+	  8,229,122,153,210,125,  3, 13, 37,218,154, 69,172,247, 66,120, 35, 33, 56,187,
+	 78,145, 28,152, 72, 80,125,235,239,135,  8,245, 90,205,188, 94,223,185, 90,118,
+	109,104,121,163, 10,221, 30, 60,168,148,110,134, 58, 54,204, 27,103,181,219,176,
+	236,115,241,223,234,141, 90,144, 33, 63,201,154, 92,228,119,156,231,246, 29, 51,
+	 27, 45,241,  5, 95,156, 89,224,202,105, 85, 50,196, 62,151, 62, 29,223,193,100,
+	122,122,254, 95,172,245,123,190,212, 53, 99, 76,242, 60, 60,124,195, 97,158, 72,
+	 37,165,173,184, 85,162, 37,205, 99,147,119, 31,246, 89, 25, 60,114, 44, 51, 99,
+	254,168,244,214,109, 97,246,188,238,218,200,104,102,  6,150,107,128,187, 81,202,
+	208, 37,202, 91,202,221,235,145,106,189,117,255, 16, 14,232, 68, 55,190, 47,245,
+	181,178,175,240,250,125,168, 74,151,101,  1, 74,139,128,223,249, 35, 17, 44,178,
+	 95,201,218, 12,242, 55,250,138,152,170,233,227, 94,241, 85,162,100,192,177, 88,
+	131,209,105, 47,  2, 22,210,224, 49,250, 75,215,243,232,253,224,233, 12,159,176,
+	210,174,152,  3, 65,  8,221,102, 19, 67, 44, 73,204, 16,163,230, 67, 74,222, 62,
+	229,188,243,156,243,  0, 50,197, 75, 83,233, 33, 89, 51,128,132,245,215, 91,125,
+	172,  0,  3,147,147,185, 67, 84,190,205,229,125, 11, 82,200,135,248,203,115, 12,
+	169,155,200, 95,138,208, 17,137,216,182,141, 70,202,164,223,187, 41,199, 43,104,
+	 80, 88,235,214,217,155, 86, 72,228,235,145,121, 83, 80,185,183,125,116,108,178,
+	 14,243,164,229,214,195,144, 54, 29, 89, 18, 11,233,146, 34, 53,251,  5, 37,232,
+	151,162,227,188,177, 53,211,206,231,143,211, 96,224,251,198,171,174,120,134,107,
+	 11,199,179,165,131,  0, 14,119,141,136,189, 12,207,  5,134, 19,148, 91,189,  1,
+	239,110, 20,220, 12, 51,103,187,173,231,155, 40, 65,123, 51,147,208,166, 50,241,
+	236,202, 12, 71,242, 49,255, 85,236,176,201,  5,243,  5,208,173, 32, 87,226,237,
+	254, 17,249, 24, 64,147,188,213, 82,234,182,111, 14,212,156,127,102,147,136, 20,
+	219,253, 66,243,222, 26,109, 88, 39, 61,153,102,113,197, 39,100, 70, 32, 71, 32,
+	 93, 91, 64, 83, 64, 65,214,242, 90,  7, 69, 40,210,  2,212, 21,215, 55, 57,144,
+	153,200,174,251, 90,  6,195, 68,169,238,252,175,131,203,177, 75, 47,230,163,132,
+	 80,  8,246, 92, 59,249,248,238,118,108,116,206,254,245, 72,107,254, 71,231,198,
+	174,117, 80,141,109, 87,143, 15,116,153, 92,192, 63, 89,196, 21,149, 18, 94,148,
+	 95, 41, 72,131,115,146, 28, 38, 97, 19,199,208,101,119,236,215,196,238,133,181,
+	 68, 78,154,163,185,131, 88,117,  1, 80,196, 12,156,161, 87,246,166,123, 82,203,
+	 46, 53,113,108, 53,169,209, 31, 73,130,249, 59,136,173, 16, 47,190,181,209,163,
+	 97, 13,206, 45, 75, 87,103,220, 86,106,197,189,123, 75, 53,226,186, 45, 30, 48,
+	136,  6,196, 81, 28,242,224,242,206,185,104, 27,189,203,171, 57, 19, 31,241,215,
+	 44,184,215,170, 42,207,190,  3,135,101,170, 99,  0,172,139,225, 53,188,159,187,
+	100,  7, 95,150,124, 62,170,127,201, 10, 75, 22,149, 30,140,244,160,101, 56,124,
+	 67,252,251,112,233, 18,165,221,127,106,157,124,175,190, 58,242, 97, 27, 85,  9,
+	 92,239,196, 88,240, 42, 88, 55,207,233,115, 96,246, 24, 20, 90, 73,125,193,194,
+	231, 68,165,209, 89,134,225, 55, 61,109, 69, 59, 87, 78,223,242, 66, 84,178,188,
+	217,244,135,187, 56,164, 16,195,102,232, 39, 78, 96,110,228, 32,123, 80,208,251,
+	202, 74, 98, 72, 90, 40, 89,222, 93,  9,230,114, 59,221,166,166,181, 34,206, 92,
+	132,108,215,123,229,133,172,133,159,  1,166, 29,  8, 23, 91, 37,173, 81,212, 49,
+	 62,173, 99,214, 82, 56, 92,160, 23,123, 90, 43,234,245, 78, 24,230,216,245,137,
+	 75,119, 77, 73,127, 88,146,156, 30,166, 24,207, 18, 27,229, 82, 19,191,245,126,
+	181,213,180, 49,110, 43,192,254, 36, 21,255,134,139,169, 50, 50, 76, 66,162, 46,
+	 19,158, 99,150,185,198,147,166,211,114, 41,207, 54, 29,188, 94,149,207, 79, 89,
+	238, 96,184,146, 23,249, 83,208,209,111,167,135, 19,207,170,143, 88, 15,235,135,
+	231, 36,134,241,226, 41,153,114, 87, 53,171,217, 25, 65, 77, 28,177,202, 85,109,
+	183,201,217,138,165,147, 62,168,109,251,149,205, 28,186, 77,123, 24,255,139,220,
+	220, 92,146, 52, 18, 73, 53,147,172,164, 31,149,156, 45,154, 80, 29,249,140,226,
+	  1,139,163, 35,118,244, 48,114,154, 57,102,253,205,208,142,201,210,160, 94,150,
+	 15,222, 44,100, 60,104, 30,253, 42, 63,182,213,185, 37,154,102,209, 62, 95,117,
+	 20, 68,  2,205, 58, 75,133,132,240,169, 44,144,173, 84,148,235,212,229, 49,232,
+	192,160,108, 57,214,188, 12, 43, 14,220, 29,227,220, 64, 68,122,148,101, 89,105,
+	182, 41,104,205, 26,251,105, 84,152,159,100,214, 72, 39, 98,  6,105,134,  3,238,
+	 18, 66,182,249,167,216,121, 63,147, 93,198,182, 70,203,161, 43, 86, 93,242,128,
+	 72,128, 17,216,246,196,  3,217,223, 20, 53, 75,148, 35,108, 79,189,205,175, 63,
+	 65,129, 89,206,192, 55,114, 35,  9,103, 69,214,152,242, 45, 12, 35,197,207,104,
+	164,169,251,140,203,218,222,250,189,174,217,195,255,  1, 15,116, 99,197, 86,133,
+	104,189,101,118, 68,198, 83, 59,236,111,201,222,234,251,  5, 17, 87, 91, 23, 27,
+	244, 25, 13, 75, 79,248,119,193,249,114,136, 35, 89,123,114,198, 72,222,144,165,
+	166,249,249, 21,219,170,  7,174,101, 76,122, 96, 84, 20,237, 69,  2,216,149,235,
+	 16,143,  0, 51,117,234,  3,146,110, 34, 73,133,180, 66,115,236,101,224,100,  7,
+	 31, 95, 88,252,200, 13,149,168,119,  2,234,222,122,207,210,158, 10, 91, 16, 49,
+	 63, 56, 29,227,188, 32, 94,119,193, 65, 50, 66,  4,198,196,124, 72,164, 72, 51,
+	 40,247, 74, 23, 64,190,243,195, 82,117, 76,210,121,162,250, 30, 99,143,117,114,
+	105,193, 49,223,146,249,222,219, 63,177, 89,105,129, 36,174, 96,103, 90, 25, 97,
+	 59,216, 55,  3, 43, 56,140,185,136, 22, 63,180, 40, 67,178, 66,233, 92,248,214,
+	 42,229,225,191,238, 95, 71, 51,180, 33, 36,172,200, 66,143,103,201,171,150, 56,
+	161,217, 24,182,186, 37, 27,183,201,230,233,148, 42,131, 10, 43, 42, 90,193,182,
+	186,197, 75, 38,186,231, 82, 53,201,160, 31, 84,123,112,115,120,242,106,171,153,
+	208, 86, 28,229,131, 84, 29, 21, 93,175,145,248,152, 30, 64,196,  1, 81, 58, 81,
+	 83,  6,156,225, 51, 11,252, 14,255,172,136,  5,122,128,171,188,115,220, 83,146,
+	232,176, 33,148,122, 41, 24,250,241,222,166, 45, 53,170,  1, 75, 15, 72,  7,128,
+	185, 21,180,236, 35, 60,125,211,242,112,  2,124,174,233,245,174,160,154,  3, 12,
+	 10, 61,176, 78,142,248, 24,223, 69,  3,210,240, 70,106,221, 83, 14,246, 58, 76,
+	246,117,  1,160,213,117, 36,138, 47,218, 81, 19,121,207,  6, 82,234, 18, 60,215,
+	190,193,180,173, 65,239,102, 90,132, 50,207, 82, 63,173,191,222,172,236,103, 22,
+	219, 27, 70,128, 83,135,231,233,254, 92, 38,139,212,240, 75,215,197,221,193,179,
+	110,158,182,238,179, 40, 88,189,111,189, 35,202, 46, 12, 48,180,223,124,112,118,
+	  5,246,208,104,214,188,244,241,  2,229,161,210,116,155, 71,246,157,247,247,194,
+	 49,219,  2,  3, 10, 14,178,125,244, 65,171,129,211,167, 10,165, 52,159,137,156,
+	246,153,134, 89, 58, 60,115,106,156, 98,139, 17,134, 39,  1, 13,123,208, 30,139,
+	 34, 60, 93,210,117,171, 88,118,219, 99, 81,107,199,115,149,115,147,182, 98,133,
+	215, 11,171,150,156,225,249, 51, 97, 45,113,215, 37,117,172,  8,208,203, 46, 46,
+	225,191, 11,149,171,198, 23,166, 28, 43, 42,192,194,  2, 34,251,229,138,229, 47,
+	146, 25,217,119,216,231,159,131, 64,116, 57, 12,201,144, 76, 96, 94, 26,226, 23,
+	219,193,  7, 50,202, 68,113, 52,123,139,203, 11, 55, 16, 76, 11,141,251,197, 51,
+	179,131,159,190,123, 56,160, 61, 43, 76, 11,109, 73, 28,219, 97, 30,242,141,105,
+	209,144,249, 90,216,216,125, 14, 80, 57,234,161,225, 90, 48,149,163, 27, 82,232,
+	211,108,193,142,203,186,141,121,  3, 73, 75,176, 12, 65,233,113,184,156,198, 45,
+	  3,213,251, 43, 76,123,109, 46,211,255, 46,164,165, 80, 87, 52, 46,110,218, 42,
+	229, 37,109,142, 10, 97,246,  1,211,226, 36, 95,120,250,110,188,173,138, 52,254,
+	181,120,155, 90, 78,161,115, 43,194,216, 58, 59, 44,  2, 39,178, 26,194,155, 92,
+	244,246,124, 65,207,247, 37, 89, 71,206,152,  8, 59,160,175, 24, 48, 54,175,255,
+	 79,106,138,145,241, 30,213,232, 88,238,  5,175, 38,118,177,169,207,147, 56,179,
+	224,220, 93,247,153, 14,141,227,106,167,243,103,114, 72,169,112, 75,  7,163, 71,
+	 91,242,165, 49,151,  2, 76, 33,217,194,132, 65, 37,200, 22,140,249,246,196,170,
+	222, 86,183, 10, 33,223, 95,155, 53,204, 25, 12,181, 60,  7,120,227,140,171, 54,
+	152,211,233,238, 49, 55, 53,  2,242, 72,177,  8, 16,128,194,  6,254, 37,140, 98,
+	227, 22,152,  2, 88,121,164,119,183, 67,246, 16, 36, 79,120,114,184,130, 69,109,
+	149,109,177,170,242, 31,127,150,251,143, 45, 30,107, 67, 44,161,239, 64,186, 69,
+	126,101,180, 47,143,244, 22,117,132,199,253,100,249,114,162, 31,246,132, 34,129,
+	137,186,106,100,231,255, 89, 80, 81, 29,233, 41,  7, 65,218,245,242,129,222, 79,
+	 38,156,220,155,126,  9,149,198,211,150,117,173, 22, 42,153,115,123,237, 27, 86,
+	152, 99,109, 60, 90,200, 16, 26,139,159,148,218, 10,134,196,155,223, 67,246,217,
+	 45,196,116, 86,140, 31,133,101,203,  5,155,164, 76,237,176,102,  1,225, 91, 50,
+	160, 77,134,227,244,205,216,161,191,147,136,220, 57,206, 77,177, 45,113, 21,226,
+	106,229,201, 29,248, 15,208, 78,152, 74,237,128,227,109, 81, 17,179,193,135,183,
+	115, 95,177, 97,204,188,193, 67, 29, 49, 92, 54,132, 48,238, 95,231, 12,224,196,
+	243,159,235, 47, 83,238,253, 25, 36, 96, 56,131, 51,221,177,154,120, 27,197,178,
+	149, 18,204, 89,228,  2, 28, 36,107, 99,222,220,116,124, 30, 46, 48,241,154,146,
+	175,125, 57, 18,170,199, 85,179, 96,160,182,122,144,181,218,186,228, 32,109,182,
+	127,110,121,218, 47,119, 89,  5,243,101, 14,136,176, 44,240, 56, 55,213, 20,137,
+	222,189,182,239,206, 16, 31,  6,215,155,126, 80,199,  5, 55,134,195,116,178,227,
+	140,196,123, 53,240, 26,140, 63, 42, 29, 95,245,162, 71, 25,175,146,204,103,169,
+	 82,116, 81,166,136,145,193,100,126,127, 37, 28, 85, 52,130, 96,133,115, 70, 67,
+	121, 17,122, 66, 14,232, 27,134,238,188,  7,177,177,255,185,111,  1,184, 22,  4,
+	128, 34,165, 22,168, 93, 73,171,232, 80,224,148,129,149,234, 24,144, 25, 33, 44,
+	142,243,243, 56, 58,197,249,166,242,243, 14, 24,176,142,168, 67, 57, 56,180,251,
+	  5,142,158,175, 48,219, 14,193, 66,168, 14,154,247,185,223,119,231, 13,112,148,
+	 13,160,114,171, 51,183,150,184, 26, 81,239,238, 90,173,102, 25, 17,237, 59, 27,
+	226, 78,164, 43, 54, 50, 38,141,218,173, 21, 16,233,115,152,160,239, 99,166,145,
+	 44,111,235,191,241,170,211,151, 81, 93,125, 74, 62,237, 62,120, 93, 56,134,126,
+	 26, 79, 56, 80,143, 56, 25,109, 92,195, 29, 82,119, 51,106,152, 47,  8, 42, 76,
+	175,100,180,232,154, 30, 58, 86, 98, 68,243, 83,  4,174,136,167,207,167, 93,107,
+	 66, 36, 69, 73, 23,254, 51,179,231,141,154,113,100,171,  7, 72, 49, 54, 59,  2,
+	 78,171,186,170,163, 33, 64,152,121,233, 61,164,170, 52, 95,185, 89,182,166,180,
+	 54,132,102, 70, 16,165,210,237,156, 26,151,117,232, 82,216, 71,105,115,221,240,
+	 42,213,218,254, 54,107,115,245,182, 12,143,113, 13, 98,244,165, 40, 56,212, 30,
+	255,156,139,  9, 79, 90,132,171,252, 50,221,112, 96, 69,225,224,165, 53,141, 22,
+	 13,217,122, 94,247,  9,145,141, 98,121, 96,149,110,179,244,235,225,204,143, 40,
+	204, 99, 53,187,101,199,204, 65,224,232, 34, 79,182, 93, 79,158,128,  9, 62,161,
+	178, 14,234, 24, 30,230, 40,139,182, 23,203, 54,182, 81, 10, 88,  2,108, 81,236,
+	244,137,194,237,113, 86,218,141,179, 89,208,143, 29,224, 76,206,127, 65,145, 45,
+	 87, 12,174,  1,116,169, 98,188, 62, 52, 51,135, 61, 19, 95,134,175,217, 73, 58,
+	 90,237,146, 32, 96, 11, 74,190,192,198, 47,105, 12, 33,122,163, 42,167,207,136,
+	154,  5, 45,159, 65, 71,186,252,121,  8,249,144,199,215,183,200,  8,133, 31,117,
+	114,251,125, 20,246,  3,154,162,251, 85, 93,176,248,212, 35,215,233,161,176, 99,
+	 58,105, 72,137,215, 72,190,135, 31, 93,182,139,127,187,217, 96,248,246, 62, 83,
+	162,220, 98,241, 26, 61,120,197, 61,193,207, 28,104,111,112, 21,150, 71,195,147,
+	 63,175,238,207, 58, 47, 60, 47,119,199, 98,201,108,164,121,  6, 58, 99,216,252,
+	126,214, 20, 61, 83,131,238, 37, 21,149,116, 58, 23, 36,128,174, 82,199,128, 95,
+	106,115, 29,193, 99,242,198,133,106,191,151,140,203,209,218,110,171,231,191,233,
+	 98,159,178,229,222,197,157,130,114, 86,160, 99,135,178, 17,174,108,253, 87,152,
+	177,218, 93,204, 71,157, 36,190, 44, 26,203, 50,196, 37,163, 70,180,246, 76,178,
+	116,127,111,224,161,154,253, 21, 70,225,157, 47,143,133, 93,139, 12, 53, 53, 40,
+	141,242,206, 68,157,243, 82,152,138,135,176, 90,144,201,151,154, 19, 25,149,155,
+	206, 11,195,118, 36, 37, 99, 44, 70,210, 65,157, 59,213, 76,226,163, 93,236,153,
+	150,130,154, 59,230,176, 14,191,147,239, 22,247,247, 87, 44, 44,167,123, 37, 95,
+	124,194,187,160, 40, 55, 21,215,  1,185,103, 61, 44, 79,229, 94,238,101,193,213,
+	199,167,226, 98, 58,222, 79, 83, 68,152, 96,173,231, 31, 81, 40,133, 85, 83,161,
+	193,111,220,186, 81,204,180,121,181,189,236,217,194, 91, 50,172,218,142, 37, 94,
+	201, 49, 59, 47,186,239,245,251,167, 84,247, 28, 69, 47, 63,214, 25,183, 78,114,
+	  3,226,100,199,247,190, 32,194, 45,188,167,229,193,240,194,136, 58,182, 10, 33,
+	 36,210,206,101,203,206,107,159, 36,117, 19, 86,221,231,130,156,  9,236, 67,138,
+	181,125,216, 13,189, 10,125,177,131, 55,172,150, 50,173,169, 44,121,135,144,202,
+	  5, 20, 99,212,218,113,103, 87, 52, 43,  5,197, 78, 99, 51,178, 37, 18,255, 44,
+	 65, 70,176, 41, 49, 13, 47,166, 68,244,136,165, 49, 16,173,129,165,254,  3,142,
+	149,243, 70,243,114,104,122,241,149,254,255,  0, 15,143, 59, 25,160, 18, 36, 92,
+	128,140,124, 48, 89,225,174,  0,240,176,245,136,253,137, 92, 94,180,172, 55,207,
+	120,130,168,183, 60, 80,114,140, 13, 15,145,226,191,194,241,103,240, 85, 62, 91,
+	121,243,111,104,251,191,154, 37,214,226, 43,173,  1,187,  1,146,121, 81, 99, 31,
+	 20, 13, 78,206, 14, 37,178,107,209,242,233,234,230,  8,208,159,200,107, 72,166,
+	 62,169, 20,144, 98, 13,  5,190,205, 87, 25,155, 60,239, 33, 74,202,230,219, 15,
+	216,141,177, 86,204, 25,247, 51, 50, 35,251, 80,124,157, 17,108, 51,102,191,242,
+	195, 87,176, 49,198,189, 93,112, 19,158,153, 11,133,252, 85, 54, 14,  2,196,121,
+	170, 58,169, 67, 56, 73,240,118,219,238,  4,  1,127,246, 77, 48, 40, 40,164, 84,
+	 54,234,103, 36,205, 84,255,129,217,240,177, 66,255,130,125, 37, 52,123, 47,162,
+	 94,155,120, 63, 25, 30, 54,225, 58,130,123,127,120,118,196,163,122, 46,  4, 73,
+	238, 75, 80, 32, 91,136,104, 55,131,197, 15,155, 23, 66,242, 37, 36,122, 12,131,
+	 62, 16,173,252,166,161,108,  9, 65,247,116, 67,  3, 11,156,225,247, 42, 88,181,
+	 70,180,113,225,162,176, 96, 53,226,132,251,195,241,233,143,190, 99,241,162,247,
+	 67,116,147, 30,122,220,253,143,155,204,101,186, 45,165,185,136,204,234, 44,138,
+	162,135,183, 56, 63,247,107,199,201, 23,191, 20, 14, 31, 14,143,181, 91,161,236,
+	151,169, 60, 90, 36,220,198, 93,139,178,226,116,157,240,250, 23, 10,191,199,170,
+	171,197,165,120,115, 16, 74, 98,146, 73, 71,  8,145, 96,254, 19, 29,215, 93,135,
+	 45, 92, 24, 51,147,122,  4, 11,113,  4,186,108, 19,160, 68,221, 73,214, 13,220,
+	168,179, 98,209,243, 76,221,238, 51,108,125, 97,226,245,249, 15,206,119, 79, 27,
+	220,128,107,170, 15,141,174,254,239,130, 34, 68,180, 11,  3,180,212,  2, 61, 95,
+	124, 14,200, 57,111, 99,116, 51,182,176, 93,243,137, 52, 42, 36,176,114,155, 92,
+	 83,180, 64, 10,123,246,176, 77, 77,112,207, 90, 88, 43, 82,126, 61,159,226, 17,
+	 51,222,117, 46,161, 83, 49, 19,149,146,138,102,231, 44,142,103,214,133, 32,134,
+	 60,154, 85,123,101,205, 30, 44,216,251,137,241,208, 28,138, 86,134,159,116, 43,
+	 92,154,189,  5, 62,136, 98,117, 87,148,176,118,224,238,218,145,152,229,219,133,
+	255,243,190,127,214, 94,228,161,251,120,210,104,229,145,  0,118, 39,218,225, 53,
+	251,105, 12,191, 51, 57, 97,190,172, 85, 51, 34,145,227, 51,183,216,213, 54,136,
+	144, 37,191,161,255, 83,220, 92, 47, 55, 68,183,115,243, 91, 60, 13, 83, 13,242,
+	129,117, 18,248,116, 94, 40,209,236, 14, 27, 29,221, 50,132,110, 27,161, 17,105,
+	  8, 16, 32,197, 30,117,212, 85,242,103,122, 45, 16, 93, 57, 82,138,253,189,207,
+	 18, 72,173,138,228,141,205,178,155, 81,152,179, 84,155, 54,252,172, 36, 94,196,
+	120, 42,173, 20, 66,184,161, 78, 43, 80,167, 29, 25,  1,118, 48,187, 72, 31,178,
+	 17,113,198,207, 43,103,140,122,252, 17,103,239,244, 16, 19,219, 37,  0, 55, 73,
+	 19, 89,147,254,186, 44,233,138,159,202,234,236, 65,  4, 48, 83,162,176,240,111,
+	 30,238, 36,135,192,251,113,237,172,105, 66, 19, 31, 34,208, 43,136,229,154,123,
+	134, 81, 53,139, 86,192,168,136, 98,101,  1,233,236, 72,132,168,133,158,180,183,
+	173,121,126, 39,196,154,242,182,142,173,255,128,211,132,215, 16, 17,176, 29,178,
+	246, 76,149, 90, 97,135,253,255,110,215,178, 14,117,224,138, 48,252, 69,221, 45,
+	124,159,191,236,117,183, 41, 43, 67,108, 46,150, 27, 31,231, 95,120, 32,120, 79,
+	153,184, 90, 96,104,179,211,104,204,147, 90,126,150, 81,114,216,219,220, 70,140,
+	130,209,151,121,169,220,208,185,220, 31,129, 58, 65, 74,253,204,202, 71,213,160,
+	183,131,164,183,238,227, 58, 88,188,197, 51,138, 76, 17, 95,196, 42,248,100,157,
+	 63, 48,151, 41, 40,137,103, 98, 40, 50,140,141,129,  7,114, 20, 73,205,238,182,
+	144, 16,121,232,170,151,238, 36, 22, 59,  5,241, 43,207,  2, 47,239, 78, 75,196,
+	 95,157,149,166,164,112,217,126,236, 37,250,128, 65, 83,166, 77, 55,156,121, 38,
+	162,220,250,205,  7,114,237,184, 44,188, 51,241,139,180,224,188,137,203,211,114,
+	 78,  2,118,  0, 32,157, 16,232, 50,165,142,216, 49,160,226,234, 55,180,185,135,
+	228,224, 19,203, 48, 19,128,172,197,179, 22, 80, 64, 42,116,  0,167,155,153,242,
+	 17,131, 96, 12, 50, 39,204,  7,146,172, 74,242, 70,255,198,204, 30, 32,154, 97,
+	 32,239,146, 11,252,  3,249, 51,114,106, 54, 38,251, 77,181,110,147,244, 91, 69,
+	150,223,228,114, 81,246,  3, 42, 46, 59, 79,233,116,222,156, 11, 23,138,220,252,
+	 47,184,125,249, 59,132,  0,115,  2, 27, 26,223,134,137,255,114, 26,250,255, 34,
+	198,119,185,120, 98,219,229, 89, 27,200,128, 69,107,127,217,112, 35,156,223,253,
+	122,253,233,191,211, 19, 11, 44,105,210,215,185,133,143, 52,143, 46,  2,125, 65,
+	112, 80,233,  1,124,218,212,155,245,242, 53, 17,148, 18,231, 69,136,200, 86,122,
+	 10, 75,156,  8, 38, 66,239,243,137,110,123,216,138,151, 44,109,147,162,252,129,
+	142,248, 91, 34, 48, 28, 35,141,  6,103, 57,177, 37,  8,188,116,194,233, 27,208,
+	237, 18,114, 55,210,169,150,122,227,111, 88, 86,183, 43,218,159,231,136, 73, 40,
+	237,211, 19, 65,132,238,  3,235, 46,161,245,112,229,237,116,209, 81, 24, 30,237,
+	  0,101,150,155, 32, 51, 31,122,244, 56,117, 31, 11,196,249,131,224,123,  8, 12,
+	166,221,225,243,216,193, 38, 73,245, 17, 92,254,242, 74, 71,223,189,121,157,239,
+	208, 48, 11,184, 45, 26,106, 59,201,127,109, 26, 30, 12,121, 47,158,223,142,103,
+	 68,113,126, 36,  4, 66,213, 21,102, 81, 60, 60,216,154,  3, 53, 32, 56, 33,176,
+	212, 17,194,246,171,107,143,112,163,168,148,203, 16, 70,168, 84,204, 59,156,107,
+	174,  5,241, 92,139, 35,  2, 95,202, 74,212,189,241,227, 12,230,221, 64,188,187,
+	 20, 20,142,  4,113, 82, 93,248,242,166,186,174, 54, 54, 34,135,155,100, 47, 85,
+	177, 97,110,229, 47,164,166,210,110, 86,125,137, 43,237,172,108,218,234,181,221,
+	 46,251,172, 98, 87, 44,120, 31, 69,218, 28, 98, 17,172,120,174,117, 39,142,  4,
+	194,123,192,227,214, 42,252,143, 68, 34,  4, 45, 85,211,237,233, 30,254, 56, 64,
+	179,215,246,250,113, 30,148,123,210,209, 47,132,  0, 33,192,236, 37,188,191, 75,
+	102,101,193, 48,253,252, 42,136,105,231,152,197, 40, 18,217,147,170, 30, 15,137,
+	  7,135,171,162, 95,146, 28, 31,157,120,125,210,178,129,113,208,217, 95,185,  6,
+	 24,218,139, 73,  0,117,215,255,218,215,247, 38,106,141, 58,198, 96, 96,199,107,
+	173,114,239,  1,117,156,203,108,125,223,223,212,154,124, 24,143, 48,231,198,235,
+	108,236, 26,126, 31,140,240, 14,114, 38,173,137, 45,  9, 38,225,235, 71,189, 74,
+	  9,138,141,202,240, 69,226, 99,161,186,166,249,128, 62, 71, 19,166,114,117, 89,
+	150,160,205,194,158,102,103,231, 19, 16, 15, 17,192,100, 17,224, 54,199, 23, 16,
+	 77,124,104, 32, 41,217,118, 31, 68,120, 56,236, 93, 55,250,  3, 28,106,142,137,
+	 43,120,236,114,244,169, 44,233,136,100,179, 35,255,120,156, 37,225,240,147,175,
+	210,114,246, 92, 35, 13, 58,157, 91,107, 23,109,253,201,118, 92,116,106, 54, 23,
+	 83,104,128,214,151,246,189, 89,114,112,243,122,211,217,135,232,253,202, 20,151,
+	224, 53,  0, 53, 61, 39,244, 31, 16,142, 81,158,119, 15,134, 24, 43,124,248, 94,
+	 98, 16,186,217,186,157,  8,108,224, 60, 93, 23,  5,178,124,133, 41,185, 19,  4,
+	170, 29,230,161, 33,133, 67, 27, 77,248, 24, 55, 13,161, 72, 29, 53,129, 19,213,
+	 23, 50,244,243,150, 69, 52, 53, 53, 84,204,205,229, 44,235,160,110, 44, 86,158,
+	214,250,183, 69, 55, 77, 22,247,130,187,222,186,204,221,155, 70,111,255,133,  6,
+	  5,120, 94,213, 31,159, 25, 69,172,104,178,214,  1,  5,230,183,196,110, 69,134,
+	222,159,154, 99,208, 59,174, 24,103,117, 54,139,207, 65, 87,255,195,136,186, 80,
+	156,237,179, 14, 27,160,243,187, 60, 59,154, 73,252,229,251,150,254,232,  2,247,
+	 36,114,241,234,253, 43, 23,237, 10,218, 53, 75, 10, 48,122,196,165,197, 27,229,
+	164, 75,182, 34,170, 79,172,213,202, 58,206,174,120, 13, 59,208,251,200,228, 38,
+	 88,153,237,231,248,229, 65,226, 46,108,231,210,143,105, 72, 22,  7, 95,249, 19,
+	 66, 14,143, 78,205,169,165,  8, 72, 45,104,230,234, 42,232,219, 16,116,107,237,
+	198,152, 20,238,192,250, 25, 86, 65,169,208,176,251, 30,254,206, 43, 45,185,182,
+	212,222,122, 86,  9,201, 43,144,130, 67,188,173, 23,223,220, 26,117, 82, 55, 17,
+	  5, 86,159,194,101,241,  6,163, 82, 54, 10,117,140,196,169,118, 97,157,208,206,
+	117, 16,247, 92, 56,232,220,140, 83,136,148, 69,  8,226,226, 99,109, 73,152,212,
+	224,160,118,238, 99, 76,114, 30,189, 75,192, 64,205,166,156,169, 66, 36,195,183,
+	101,  2,169, 12,108, 65,108,216,222, 56, 37,238, 39,160,176, 48,245,235,  0,147,
+	149,109, 79,191, 25,197,200, 46,192,114,118, 91,175, 96, 22,  0,226,  3, 73,162,
+	124,188, 86,125, 49,131, 31,130, 53, 59,133,255,122,192,242,219,152, 59, 76,125,
+	128,  8, 20,162,155,142,113, 86,200,124,247,127,193, 89,173, 83,192,178,105,155,
+	206,188, 96,168,199,231,250,219,239,137, 63,148,167,183, 60,190,135, 41,228,191,
+	 64, 48,254,241, 70,104,219,249,221, 63, 73,  7, 31, 87,185,172, 32,135,115,126,
+	 62,213,250, 99, 96, 53,179,245,188,129, 14, 41, 65, 60,220,114, 72,183,134, 72,
+	157,237, 26, 18,251, 81,157, 24,200, 84,176,112, 78, 77, 43,144,186, 19, 46,251,
+	 64,110,188,195, 45,101, 42,214,  5,246,161,108,182,213, 97, 72, 64, 59,181, 16,
+	181, 37,229,188,196,149,179,127,130,130, 49, 70,171,235,117,151, 69,120, 77,168,
+	120,221,127, 91, 92,106,113,234,220, 11,105,223,209,172, 42,232, 66,201,157,130,
+	 55,189,219,  4, 60, 17, 88,144,193,151, 70, 14, 48, 58, 32,184,218, 16,  0,131,
+	 48,199,102, 57, 99,198,101, 60,242,233, 98, 47,157,163,154,211,  1,114,140,147,
+	 51,159, 41,202, 25,117,193,101,175, 65, 49, 72,101,119, 22,156,175,241, 82, 46,
+	230, 27,122,  4,116,106,119,216,245,  1, 17, 35,  7,196, 92,202,220,207,191, 94,
+	236,178,119,233,145, 91,131, 50, 29,248,209,  1, 96,189,177, 87,  8, 16, 54, 99,
+	165, 49,  9,168,197, 22,117,128,185,114,177,176, 90,123,189,  1,176,240, 30,179,
+	109,108, 77, 32, 68,241,194,213, 61, 68,143, 24,157,125,231, 66,255, 16,231,168,
+	204,129,  9, 13,211, 88, 88,172, 40, 86,  0,151,114, 46,187,135, 98,123, 26,145,
+	105,175,243, 53,150, 93, 12,139,124,111, 65,137, 82,215, 26, 57, 56,219,194, 66,
+	125,170,145, 12,203,102,115,141,112, 59,198, 27,227,118,217, 35, 40, 34,204,157,
+	102,105, 99,247,234,132, 93, 98, 47,109,248,169,102,154, 85,123,128,127, 97, 35,
+	109,167, 29,200,166, 88, 84,199,180,224,177, 20,194, 35,183,147,139,145, 66,250,
+	153,159,205,131, 90,168,204,105, 59,234,196,248,120,137, 14, 83,236,183, 26, 49,
+	148,230, 82, 99,129,237,137, 21,197, 30,185,201,188, 97, 20, 36, 51,248, 10,240,
+	207,184,199, 68,247,150, 66,112, 62,104, 98,131,140, 27,232, 69,134,101,115,241,
+	  3,102,131,229,102,201,190,  3,211, 94, 48, 66, 41, 88,205,186, 62, 23,  0,102,
+	137,229,223, 24, 50,152,255, 22,138,218, 10,  6,100, 91, 14,203,166,194, 60,244,
+	 16,252,123,135,197,120,108, 50,134, 22,  6,160, 14, 89,  3, 84,205,121,105,253,
+	120,117, 40,182,210,156,189, 15,202,140, 59, 52, 24, 59,107,246,137,212,115,218,
+	212,113,187, 46,  8, 82,167, 73, 91,152, 57, 93,137, 11, 66, 10, 98,114,108,213,
+	230,251,176,169, 51,197,146,237,128, 33,180,162,236,161,129,238,138,107, 26, 29,
+	  4,227,107,148,101, 92,168, 32,116,135, 25, 89, 23, 85,  9,170,164,219,189, 30,
+	146,237,104,231,133, 33, 94,158, 92, 50,135,254, 12,238,235,102, 37, 36, 45,164,
+	180,197,124,224,159,  4,157,219, 71,138,106,140, 35,127,126,103, 29,244,230,239,
+	 88,197,153,129, 54,149, 22, 39,123,116, 65, 21,159, 62,129,171, 63,145,100,156,
+	184, 29,239,171,125, 39, 73,211,189,252, 76,116, 62,141,133,197,179, 45, 45, 67,
+	 93,236, 32, 94,171,224,128,249, 95,224, 91, 84,204,  0,129, 34,251,  2,  0,165,
+	195,196,108, 95,168,182,125,248,112, 21, 44,155,126, 36,239,178,103,190,  1,189,
+	 69, 63,255,223,120,231, 89, 40,242,  3, 17,162,195,125,250, 98,255,120,162,162,
+	235, 85,153,183,112,110,231,185,224, 63, 44,102,194,232,122,143,  8,210, 61,238,
+	228, 24,211, 72,198,230,153,  3, 62,101,201, 50,107,241,126,143,  0,108, 42, 39,
+	126, 32, 90,128,215, 17,230, 74, 88,  6,166,114, 23,128,141,200, 70, 72,199,252,
+	117,125,104,  6,121, 51,161, 54,246, 40,106, 19,254,196,130,251,184,193,159,222,
+	118, 39,159, 35,  7, 95,205,148,  7, 81,113, 50,  0, 60, 31, 99, 77,143,133,199,
+	219, 14,253,107,209, 43,237, 90,108, 27,176,105,104,139,115, 38,185,231,178, 31,
+	151,167, 40,202, 90, 62,245,234, 69, 43,221,194,210,122,190,116,213, 98, 73, 18,
+	102,208, 98, 58,194,146,136, 94,184,181, 16, 84, 55, 36, 12,212,218,217, 51,216,
+	 13,194,218,130,124, 89,212,  7, 69,180, 49, 21, 62, 79, 62,160,147,220, 77,223,
+	 72, 20, 42,133,188, 13,107,250, 46,141,195, 56,140, 96,225,249,186,154, 59, 92,
+	 21, 14,147,235,206,242, 95, 16,156, 64, 91, 79,197, 22,131,143,148,118,246, 21,
+	 23,245,235,149,104, 25,198, 24, 18, 17,131,203, 52, 11,227, 45, 31,141, 37, 58,
+	123, 52,231,180,230, 55,196, 48,197, 75,100,241, 99, 42,131,185,  7, 40, 18,142,
+	161, 70,204, 27,210, 36,238,240,212, 22,160,239,230,193, 76,193,124,179,129,150,
+	 88, 98,135,143,199, 14, 15, 77,241, 37, 78,239,119, 23,210,214, 96,137, 69,148,
+	 87, 85, 61,180, 43,155,  8,153, 38,  7, 80,200, 98,208,134,139,216, 66, 94, 94,
+	177,119,139,227,156, 56,231, 11,140,248, 13, 42, 33,245,174, 41,220, 84,134,181,
+	198,163,238, 28,226,163, 72,197, 22,249,183,112,230,217,130,132,165,130, 88,254,
+	 54,221, 98, 90, 26,194,145,106, 69, 41,164,124, 15,194,255,239, 28,182,116,110,
+	148,178, 67, 51,152,199,186,105,170, 56,138, 92,205, 45,125,242, 38, 40, 34, 85,
+	 69, 36,211,162, 94, 23,178, 49, 64, 43, 54,197, 25, 30,215, 23,179,222,196,196,
+	 27,163,155, 16, 77,151, 32, 77,199, 44, 84,203, 44,179, 78, 22,168,136,219, 41,
+	 59,218, 53,205, 49,212,191,  9,157,153,213, 25, 89,180,214,135,103,187,181,254,
+	153, 54,205, 79,201, 17,103,149, 64, 18,212, 94,153, 50,129,133,142, 74,192,164,
+	 51, 83,202, 78, 30,158,200, 31,215,121, 79,109,109,138,125,122,222,180,145,172,
+	  1,  9, 12, 20, 28,178, 30,116,164,167,171,152,195,216, 54, 16,248,252,106, 52,
+	142,105, 20,  9, 45,  7,109,182,  9,106,166,152,162,  6,113,165,145,169, 82, 25,
+	 73, 47,241,125,213,214, 76, 90, 30,204,220, 19, 48, 23, 60, 11, 56,162,232,  8,
+	248, 34, 15, 21,220,181,238,138,115,166,158,176,151,166, 77,194,206, 36, 24,227,
+	 12,190,174,120, 82,215, 65, 99,144,246, 24,223, 43,197,225, 63, 23, 36,143, 80,
+	239,122, 10,174,182,246, 96,233,123,142,194, 32, 58, 62,216,177,177,211, 48, 62,
+	 32, 52, 30, 97, 34,132,244,228,195,248,227,147, 39,119,112,178, 68,101,102,236,
+	 95,  6,128,184,172, 11,144,159,241,114, 80,253, 60,209, 68,161,179,  0, 74,231,
+	106,225, 28, 74,105,119,190,207, 19,211,110,117,236, 63,212, 35, 32, 10,126,181,
+	126, 76,243, 17,  5, 12, 65,205, 14, 68, 71,147,135,117, 53, 10,222,168,227,157,
+	185,205,123, 83,133,246,174, 56,135, 72,226,210, 44,156, 11, 30,243, 85,106,224,
+	252,170, 52,203,108,224,140,152,126,134,135,196,122, 25,213, 15,228,163,236,252,
+	173, 47,114, 64, 88,184,122,119, 82,  3, 46,192,107, 20,188,158, 70, 87, 93,251,
+	186,248, 67,255, 11, 99,138,128,178,138, 60,129,222, 52,  2,103, 72,165, 60,155,
+	137,220,190, 30,170,191,119,210,202,197, 55,  0,213,231,  3, 54,120,193, 85, 14,
+	160, 73,125, 98, 66, 58, 56,166,150, 86,201,169,244,175,203,215,230,103, 29,251,
+	  1, 99, 19, 13,218,218,238, 42,205,128, 48, 69,201,154, 17,167,239,246,140,238,
+	100,150, 49,114,154, 61,204, 40,137, 42, 34,238,178, 32,236,177, 27,151, 47,247,
+	241,189, 22, 45, 60,208,110, 43, 46,100,197,147,205,  2,252,233,207,212, 82, 94,
+	250,117,160, 25,249, 87,164,203,188, 59, 93, 29,188,187, 58,219,250,225,178, 32,
+	128, 57,242, 28,236,147,251,185,134, 33, 76,211,136, 25,167,214, 69,211, 32,187,
+	  9,  6,133,242,239, 14,140,162, 55, 11,132,204, 56,132,143,225, 71, 26,135,130,
+	193,169,179,132, 29,216, 79,108,117,208,242,164,102,153,210,145,157,173, 63,231,
+	250,113,218,148, 62,142, 84,195, 47,181,185,197, 38, 99, 15, 47, 43, 85, 81,112,
+	130,236,142, 35, 33, 12, 10,126,131,228,185,197,124,239, 68,169,168,243, 98, 15,
+	136, 63, 84,187,230,  0,224,222,230,135, 84, 90,211,  4,201,132,201,104,146,230,
+	 57,236, 78,190,227, 95,146, 34, 24,158, 65, 31, 56, 85, 44,142,162,118,125, 94,
+	 48,149,208,122, 31, 39,104,120,191, 58, 56,151,200, 99, 88,114, 22, 90, 11, 31,
+	170, 36,239,229, 53,134, 56, 67, 27,252,167,137,119,206, 38, 94, 23,120, 92, 20,
+	231,206,178,145, 35,231,248,191,246, 43, 51,117, 30,228, 87,139,224,230,242,230,
+	 49,176,136,254,102,135,  9,182, 81,106, 39,197,172, 95, 24, 72,  5,119,168, 29,
+	250,215,149,194, 65,190,206,214,141,  2,143, 95,234,139,172,176, 10, 45, 79, 43,
+	201, 46,148,125,112,133, 52,170,102,147,124,223,221,  5,141, 74,225,116,245, 47,
+	 31,137,186,228,226,124,249,193,251, 26,154,153,  0,116,120,247, 22, 35,  3, 37,
+	195,160,139, 48,108, 74,113,122, 69, 36,246, 40,182, 44,193, 61,  1,117,193,166,
+	168,136,123,110,146, 84,147, 95,201,253,255,228,236, 95,121, 11,  4,219, 34, 42,
+	 67,242, 98,146,226,204,203,194,214, 28, 74, 52,  5,202, 50,251,138,  4, 46,243,
+	149, 77,  1, 74, 16,104, 29,213,130, 73,191,117,217,219,251, 23,  7, 50, 31,157,
+	 96,173,232,248,128,104, 16,168, 12,251,192, 52, 82, 85,229, 24, 78, 72, 42, 79,
+	 79,120, 13, 14,246, 80,172,111, 85,214, 83,231, 21,  2,  0,181,100,  9,247,199,
+	174,173,160,155, 52,175,213,154,114,118, 66,139,244,203, 57, 43,250,122,  4, 84,
+	 70,134,173,188, 77, 39,115,240, 10,237,114,119, 18,134,158, 23, 71,154,173,175,
+	 72, 42,228, 58,241,211, 10,177,195,229, 73, 13,  6,144, 23,146,158, 23,160, 79,
+	204,165,225,118,211, 48, 67, 29,136, 79, 50, 41,105, 33,157,225, 64,218,104, 65,
+	 24,110,125,216, 15, 95,204,147, 16, 29, 75,103, 24,105,206,191,121,253,  3,  3,
+	 97, 44,186,221, 96, 28, 81,143,112, 44,117,241,108, 56, 87, 14,158,217,118, 76,
+	232, 64,121,  0,195,158,135,119, 71,253, 68, 59, 64,188, 44,251,206, 83,121,222,
+	100,105,252, 33,242,180,192, 50, 80,171,183, 69,233,253, 72, 86, 76, 35, 59, 62,
+	 69,104, 14,141,102,166,  8,242,105,135,254, 69, 85,  5,150,255, 20,199, 19, 44,
+	 16, 86,173,105, 80,214,132,163,240, 62,122,100,144, 72,219, 95, 55,169,206,  3,
+	  2,156, 39, 47,166,155, 64,240, 52,212,244,162, 48, 19, 71, 33,158,220,  9, 53,
+	194, 74, 10,  6, 80,165, 90,255,127, 87, 85, 36,  7,231,210,160,221, 99,143,160,
+	214, 34, 53, 28, 81, 98, 93, 58,203,153,  2, 84, 17, 37,178,127, 50, 91, 41,109,
+	195,194, 27, 66,248,243,  1,226,234,213,144,247,177,185,178,158, 41,177,176,224,
+	204,180, 39,127, 45, 97,235,124,227, 24, 31,220, 42,206,150,227, 15, 33,194, 73,
+	197,162,107,215, 86, 79,206,239,122, 41,197,198,192, 98, 75,158,201, 13, 31,162,
+	 88,117,223,252,249,  5, 45, 75,244, 44, 15,184, 90,158, 33,172, 68,147, 37, 50,
+	132, 73,141, 37,246, 50,207,116,235,138,159, 85,  6,135,249, 35,222,226,120,220,
+	229,188,167, 67, 95,215, 34,110, 10, 27,171,227, 29,210, 30, 75,166,108, 25,176,
+	136,149,111,208,136,242, 55,117,124, 56, 79, 15, 38,245, 16, 94,194,200,  3,212,
+	187,114,181, 22,230,218, 17,110,142,163,151, 12, 93, 73,105, 79,164, 10,192, 60,
+	 29,135, 13, 92,124, 10,231, 92, 91,140,250, 85, 70,176, 84,149,228,244, 32,108,
+	163, 92,252,236,107,250,255, 92,165,176,203,172,227,141,122,103, 42, 92,149, 45,
+	143, 87,146,185,218,  9,227,207,240,204, 14, 32,147,101, 42,104,251, 80, 23, 50,
+	249, 87, 83,209,255, 98,122, 18,  2, 59,112,208,156,185,219, 25,127, 40,244,116,
+	 73, 51,182,250,181,174,237,143, 30,155,228,105,171, 37,128,  6,118, 53, 97, 86,
+	 25, 66,119,146, 58,187, 64,173, 82, 96,225, 71,145,214, 14,249,199,187, 25,204,
+	249, 59,218, 95,191,190,127,168, 66, 94,  3,103, 95,157,183, 80, 52, 15,190, 33,
+	130, 58,251,162, 59,105, 90, 38,247,116, 78,199,239,174, 86,201,249, 51, 35,102,
+	214,163, 18,179,120,176, 82,116,235,190,221,151,146,135,119,159,191,118,234,220,
+	243,134,109,140,211,143,147, 68, 38,171,209, 37,156, 79,172,205,198, 20,166,158,
+	234, 52,190,121,108,132, 37,254,251,133, 91,197,108, 68,206,110,228,151,144, 22,
+	214, 38,237,191, 50,235,181, 16,209,131,149, 75, 62,  3,217,209,165,193, 65,100,
+	 39, 86, 74,176,114,136, 62,223,104, 67,171, 29,  2,228,  9,229,229, 58,196,130,
+	136, 56,104,  9,157, 42, 67, 37, 26,219, 94, 11,125,225,183,191,187,125,  5, 95,
+	224, 99,148, 26, 54,128,164,182,218, 62,  8, 49, 56, 53,148, 61, 65,194,167, 73,
+	205,191, 40,111, 80,194,212,  0, 59, 29,198, 40,237,232, 91, 33,100,215,110,215,
+	200,108,251,235,138, 16,198,175, 41,134, 67,208, 73,150,105, 34,130, 30, 63, 59,
+	 49,129, 65,255, 85,221,177,172, 84,243, 81,148,204,199,160,219,131,198,157,168,
+	135,238,204,235, 57,234,235,221, 22,201,240,176, 49,215, 85, 56, 97, 91, 59,  2,
+	 96,239,207, 83, 95, 24,128,240,161,236,114,248,244, 31,170, 99,159,182,104,183,
+	 25, 57, 77, 10,207, 82,248,149, 67,175, 79,127,145,234, 93, 66,145,232,229, 69,
+	 81,207,166,230, 11,143, 48, 90,185,118, 27,206,102,147,187,175,184, 48,165,149,
+	188,105,174,235,252,129,251,190,254, 52, 73,100,222,175,214, 93,166, 77,  4,207,
+	132,174,253,127,207,192, 72,124,218, 27, 66,235,122, 98,191, 42,145,238,176,100,
+	 82,  6,  8,  2,  9,236,171,107, 40, 79, 87, 77,251,102,252,232, 92,135,219,158,
+	126,167, 18,113, 31, 72, 61,159,218,232, 37,229,227, 53,199,190, 89,116,134,241,
+	 13,242, 13,185, 17, 26,103, 90, 14,106,117,180,119, 16, 40, 13,181, 41,254,102,
+	153,145,166, 22,243, 77, 54,237,151, 35, 28, 65, 56,254, 35,254, 31,145,202, 99,
+	181, 97,239, 35,210,250,115,234,223,226, 77,146,248, 16,  9, 46,187,251,245,184,
+	 81,229,  7,130,154,134, 35,212,207,  4,146,102, 70,165, 82, 62,237, 92, 91, 14,
+	137,133,184,210, 30, 60, 64,222,214, 10,230,106,206,127, 17, 49,  0,130,193, 32,
+	242, 23,234,155,166,240,203,224, 26,168, 43,208, 59, 86, 71,191,125, 75,147,221,
+	 61,212,110,248, 40,153,244,230,141,  0,167,243,206,165,110, 39,122,158,139, 26,
+	240, 42, 91,222,  5,193,173,224,105,200,  6, 63,235,116, 68,  2, 12, 96, 55, 59,
+	 76,127, 40, 59, 26, 53,221,226, 78,245, 98,177,172, 78,170,249, 61, 22,245,148,
+	192,221, 21, 86, 31, 13,112,213,240,208,105, 79,118,217, 23,160,199,122, 54, 37,
+	211, 25,154,122,172,162, 79,235,138, 53,252,224, 31, 78, 12,167,180,198,245,217,
+	 40,146,178,  7, 65,194,140,199,120, 98,237,185, 72,182, 85, 43, 51, 28,  8, 35,
+	191,158,222, 33,171,169,153,247,  9,171,251,243,226, 93, 28,  7, 20, 23,211,221,
+	 72,249, 35,187,  5,141, 39,202, 24,  2,255, 85,112,147,251,101,188,  6, 47, 21,
+	128, 40,132,119,148, 30, 96,170,195,187,109,168,198,246,171,220,  4, 33,215,224,
+	223,159,  9, 17, 45,247,151,241,184,227,140,192, 35,232,185,220,170, 54,203,136,
+	160, 73, 52,106,141, 28,158, 47, 75,181,218,246, 89, 64,128, 15,126, 11,196,166,
+	147,123,108,226,194, 26, 98, 63,208, 24,189,110,219,196,137,  2,199, 70, 22,253,
+	 99, 61,255, 86, 87, 47,192,116, 40,244,142,113,141, 40,234,176, 32,106, 40,242,
+	253,159,251,126, 22, 21, 22,  2,156,169,100,154,221, 97,240,240,193,114, 50, 74,
+	137,178, 79,164,157,232, 14,208, 23,248, 75, 42,147, 98,129,114,107, 66, 38,200,
+	123, 50, 68,144,176,133,198,145,227,144,  0,253,243,233, 33,130,202, 86,166,144,
+	 81, 75,202, 20, 48,125, 40, 98,  8,192,168,196,153, 88,240,254,166,193,102, 76,
+	218,217,169,175, 82,160,189, 81,107, 55,212,129, 42,187,250,241,106, 43, 53,147,
+	139, 74,151,254,226, 94, 29,228, 65,118,  5,127,128, 79, 83, 96,140,180,249, 92,
+	 37, 46, 49,140,168,  3,183, 79, 28,237,120, 45,177, 20,120,  1,255,196,108,159,
+	161, 92, 48,136,143,195,152, 58, 32,148,219,242,203,153,105, 36, 87, 44, 57,113,
+	 22,121,125,167,185,146, 61,103,131,161, 95,244,149, 18,205, 82,241,162, 54,243,
+	 82,190, 19,193,233,238,153,164,131,245,229, 21, 86,196, 34,145,168,132, 51,174,
+	239,156,162,135,100,159,249,178, 57,252,117, 69,170,243,130,194, 64,242,220,229,
+	178,108,207,186, 57, 38,224,183, 60,251,249, 12, 82,121,  7, 13,216,201, 46,130,
+	222, 26,102, 91, 56, 84, 69, 55,206,251,185,251,220, 33,196,181, 56,216,117,170,
+	222,181,250, 46, 61,242,165, 68,168,178,124, 15, 64,110,102,183,  3,239,128,103,
+	203, 44, 42,191,111, 15,  4, 66,146,183,200,108, 71,233,235, 57, 10,184,119, 27,
+	 48,158,  2,146,198,191, 98,173,162,142,197,183,106,138,132, 17,  1,219, 22,250,
+	221,231,135,160,195,226, 39,197,246,154, 80,239,117,166,245, 69, 70, 74,162,218,
+	 41,138,151, 12,127, 87,249, 61, 30,239, 62,228, 13, 53,160,150,205,184, 72,220,
+	 84,123, 13,109, 85,204, 85, 22,179,220, 98,246, 23,183, 81,121, 75,108,234,116,
+	 45,214,138,  2,198, 37,116,136, 76,239,123,242,137,250, 52, 91, 83, 28,160,200,
+	 57, 98, 25, 52,167,136, 49,208, 39,245,202, 25, 59,228,245,  8, 84, 11, 38, 91,
+	 90, 98, 32,196,  1, 46, 67,182, 34, 80,231, 87, 90,146,158,236,224, 18,  0,183,
+	139,219,229,112, 44, 38,155,  0,185,177,233,237,233,235,173,159,122,156, 97,126,
+	212,196,191,241, 14, 35,236, 12,183, 86,201,194,138,183,151, 62,116,180,227,162,
+	155,166, 92,191,184,194, 53, 93, 58,113,136,118, 61, 40, 43, 70,112,208,176,223,
+	 61,101, 96,254,140,208, 55, 67,128, 17,255,223,133,105, 61, 15,254,242,143, 12,
+	113,130,179, 20, 15, 89, 10,196,135,161,205, 63,105, 64,191,122,220,193,228,101,
+	184,165,137,  5, 80,254, 93, 85,120, 26,250,214, 52,202, 30, 61,241, 54,  9,108,
+	 99,103,248,135,172,121, 51,129,201,202,203, 13, 80, 51,134,121,127,187,170,176,
+	204,171,221,254, 36,151, 98, 19,250,105,205,185,220,191,177,175,  3,166, 42,120,
+	 59,122,234, 11,195,203,175, 43, 72,216,241,186,225, 44, 85,221,163, 20,132, 28,
+	148,243, 44,124,249, 38, 97,192,  1, 14,163,178,234,176,127,147,171,130,176,244,
+	101, 62,199,113, 16,164,238, 72, 38,101, 69, 92, 12,196, 53,165, 81,254,121,106,
+	228,152, 34, 20, 13, 47,194, 99, 45,127,219, 54,129,242,242,103, 12,184,169, 42,
+	254,211,224,210,173,154, 12,135, 94,143, 71,137,221,103,211,236, 32,  1,209,227,
+	 91,232, 47, 13,254,172, 35,232,230,194, 11,161,  2, 81,236,128, 28,254,135,170,
+	181,174,167, 44,246,226,234, 41,243, 52,156, 82,157,212, 17, 98,240,170,133,119,
+	 53, 58,125,144, 88, 87,176,197,197, 71,112,183,177,193,158,213, 63,185,144,170,
+	208,145,103, 37, 35,200, 99,  0, 12,219,163,244, 68, 93,198,212, 60, 73, 75,196,
+	152, 77, 79, 27, 26,143,123,198, 69, 25,148, 98,116,223,243, 71, 60,146,180,136,
+	123,196,101, 33,128,157,132, 43,131, 58,224,218,203,140,148, 45, 53, 21,194, 36,
+	 82,125,146,246,178,228,186,  1, 55,  3,156,196, 58,109, 23, 27, 37,201, 96,246,
+	 85, 94, 10,200, 59,168,243, 35,225,127,194,131,106,147,137,176,155,116, 72, 59,
+	 40,151,214,109, 44,162,144,182,123, 91, 40,251,104, 30,101, 33, 26, 58, 31,147,
+	 69, 90,198, 83, 94,253, 95, 47,212, 41,110,144,121,187,119,224,  4,115, 32, 39,
+	223,187,171,105,215,174, 62,255, 68,136, 21,  0, 91,152,  7, 15,107, 55,126, 30,
+	105,  0,169, 39,127,224,162,168,248,190, 89,106, 17,112, 26, 44, 20, 32,201, 46,
+	223, 96,247,152, 22,125,191,251, 33, 26,139,134, 29, 66, 22,255,195,195, 70,  4,
+	219,216,141, 62, 70,146, 78,233,  9,231,252, 65, 10,248, 92,130,217, 40, 64,102,
+	 70,111, 94,213, 12,153, 93,224,233,189,160, 87, 54,  5,216,246,103, 63,117, 23,
+	 32, 47,233,199, 34, 35,115,171, 61, 13,163,231,234, 83,102,230, 66,227, 21,133,
+	159, 46, 50, 86, 17,191,149,150,229, 55, 17, 23,137,142, 22, 68, 99, 97,120,128,
+	152,132,132, 52,104,208, 89,221,155, 10, 91,188,226, 40, 16,126,157, 18,222,141,
+	 15,185,214,154, 40,246, 88,224, 58,127,216,  0,202,232,250, 34, 29,226,160,106,
+	162,  8,247,106,105,241,149,176,221,145, 95,207,235,167,100, 54,198,238,148,115,
+	112,136,162, 86,222, 39,114, 67,206,161,  7,233,150, 87,193, 14, 97,126, 15,147,
+	 17,226, 88, 27, 22, 17, 90,194,184, 17,  1,206,253,108, 87, 24, 13,176,155,138,
+	246,163,136,180, 95,223,106,164, 25,128,132,196, 24,214,217, 28,219,132, 54,116,
+	 55,  0, 53, 66, 27,120, 57,  1,150, 19, 83,131,251,132, 12,185, 74,109, 50,131,
+	  4,250,214,227,163,228,154,113, 82, 87, 11,186,242,244,207, 78,169,107,119,179,
+	246, 33, 77,185,193,137,182,173,  5, 69,247, 33,201, 97,232,  5,176, 21, 68, 25,
+	  9,183, 67,144,237, 27,154, 60,157,136,160,240,135, 59,204, 23,240, 98, 93,  3,
+	194, 73,170, 87,159,183,189, 87,146, 67, 93,202, 18,128,195, 32, 88, 45,207,182,
+	231, 13,188,124, 75,165,108,248, 76,180,242, 20, 64, 66, 54, 13, 29, 33, 94, 39,
+	186, 59,229, 88, 25,138, 42,227,214,238,141, 36,231,234,153, 22, 65, 93,147,211,
+	113,150, 90,233,242,123, 69,147,135,211,  0,160,176, 84, 45,220,255, 19,139,116,
+	  9, 14,128,160,247,184,223,208,179, 71, 76, 85, 31, 63,187, 22,222,200,244,115,
+	214, 68,232, 92, 65,131,173, 89, 92,253,113,107,199,193,160,168, 81,127,218,247,
+	214,203,220,135, 46,166, 74,206, 66, 68, 47,231,170,114, 98, 75, 17,174,210,164,
+	207, 88,234, 49,142, 44,125,200, 68,180,115, 41, 42,150,  0,156,104, 23,146,168,
+	255, 31, 13,109,197,215, 98, 96, 99,138, 36,209, 97,148,  9,207, 10,187,203,  1,
+	159, 47,196,193, 19,119,131,236, 53,199,  9, 29, 22, 63, 78, 47,158, 69,176, 38,
+	 90, 63, 87,163, 83,206,206, 70,252,159,217,238, 71,136,169,  4,231, 97,174, 86,
+	 23,242,182,200,223,162, 57,  7,  7,166,101,143,122,162, 43,154,244,163, 95,165,
+	 80,233,134, 91,100,122,127,241,176,121,131,168,126,251, 45, 68, 49, 50, 76,130,
+	 44,216, 45,142,118,  7,202,120,195, 15,104,156, 69, 24,252,  2,211,192, 47, 50,
+	207, 62,  7,112,123, 75,170, 88,182,  0,202, 71, 29,180, 55,101, 59,148,189, 39,
+	225,187, 98, 71,129, 26, 22, 53, 16,125,237,226,170, 61, 56,  8, 82, 16,190,101,
+	129, 17,191,147,169, 83,227, 19,138,228, 58,238,164, 79, 99,245,246, 96,129,195,
+	109,235,220,238, 49, 87, 15, 27,176,103, 76,  4, 54, 25,110, 80,156,246,220, 89,
+	206,137,208, 62, 26, 70, 26,169,194,220, 65, 88, 99,113,209, 22,201,173,207, 54,
+	 53, 84, 81, 10,212, 28,107, 31,212,154,203,148,119,203, 33,213, 26,112,150,174,
+	227, 16,223,124, 64,135,115, 62, 78,157,254,251, 92,115,  0, 30, 76,231,115,238,
+	235,160, 44,205,238, 41, 10, 77,130, 37,114,101,190,149,119,106,161, 74,162, 21,
+	 24, 45,131,110,139, 18, 25, 25,189,194,108,237,102,245,204,169,168,227,244,250,
+	186,210,189,163,  6,135,158,151,172,161, 12, 76, 25,181, 82, 96, 44,248,147,133,
+	 97,  1,133, 49,209, 22,152, 95,254,175,  5,122,221, 12,119, 88,102, 25,237,185,
+	122, 21,204, 89,159, 82, 72,221,101,254,139, 10,137,100, 43,180, 75,187,145,253,
+	155,111, 74,221, 20, 69,246,  8,187,232, 13, 89,103,230,104, 57, 80,200,127,193,
+	 99,249,192, 80, 87,166, 44,116,130, 19,215,240,144, 70,204,117,212,227, 15,166,
+	129, 63, 62, 31, 65,218,246,120,111, 92,239,129, 59,154,248,164, 14, 91,245, 84,
+	179, 82, 37,159,114, 90, 15,159, 19,102,232,109,144,220, 88, 84, 11, 15, 97,124,
+	  1, 38,137, 10, 82, 14,167,187,135,193,129, 89,242,237, 36,202,205, 40,152,200,
+	118, 50,240,  0, 22,214,217, 29,124,219, 46,254,128, 62, 89, 80, 22, 21, 29,114,
+	208,236,205, 76,116, 32,129,237, 88,103, 56,103,227, 65, 57,171,  1,225,218,  2,
+	  1, 69, 15, 10, 69,115,197, 84,115,107,154, 72,214,218, 50,131,243,178,189, 80,
+	101,  0, 26, 38, 30,166,127,162,106, 67,193,223,126, 46,131,113,153,110, 20,234,
+	 71,170,152,120,158, 40,174,178,189,236, 28,153,177,117,152,150,236,100,228,156,
+	115, 75,176,164,151, 25,167,189, 88, 63,253,212,185,170,233,198, 13, 97, 99, 23,
+	159, 41,116,210,104,228,  7, 54, 33,174,194, 24,134,  5, 96, 84, 81,  2, 83, 14,
+	165,248, 83, 89,192,247,244,241, 82, 36,197,121,230,111,243,244,155,152,254,133,
+	 41,186, 58, 72,198, 89, 86,220,144,223, 23,142,145,169,158,129, 81,205,116,229,
+	246,164,128,208,248, 24,219,145,135, 12,  1,193,171,122,221,132, 57, 89,121,134,
+	 99,226, 83,119,173,150,138, 63, 83,170,249,164,133,221,  7,  4,251, 40,163,242,
+	 92, 58,100,247,  2, 38,220,244, 70,114, 97,129, 43,122, 61, 88,106,  6,140, 47,
+	149,249,105, 19,150,  7, 12,137,  1, 59,164, 82,184, 29, 88,127,  6,145, 44, 41,
+	 20,  2,115,235,166, 21, 45, 43,226, 53,111,152,201,223, 42,238, 59, 86,134, 60,
+	111,157, 17, 83, 15,204, 65, 91,247,214, 74, 36, 50, 58,217,170, 20, 97,101,163,
+	148, 68,150,116, 16,219,183, 74,114,133, 11, 47,142,208,  3,232,176,121,143, 28,
+	222,157,191, 18,225,255,174, 36, 84,102,167,255,235,235, 94,158,249,129,  3,217,
+	111,166, 46,147,254,205, 72,211, 56, 13, 44, 18,190,172, 21,231,200, 97, 45,212,
+	 15, 66, 84,202,205,227,201,151,198,187,108, 36, 22, 31, 81,186,135,214, 22,229,
+	144, 51,151,232,183,181,233,218, 39, 29, 43, 18,219,231,175,153,  8, 46, 61, 53,
+	 98,206,167,100,148, 81,213,206, 62,179,124,224,151,167,226,  0, 17,212,248,248,
+	 37,107,110, 13,200,109, 53, 74, 79,153,220,159,139,226, 62,252,185, 42,105,201,
+	 51,157,  7,185,228,252,110,252, 21,243,237,124, 37, 28, 53, 77, 17,204,175, 69,
+	 79, 39, 24,224, 95, 74,181,187, 69,162, 48,238,253,120,113, 56,165,158,107,246,
+	167,112,141,233, 19,  6,158,173,179, 54,220,184, 62,  2,108,110, 46,105,116, 83,
+	 78,239,135,154,  3,138,140,158,205,168,169,121, 61,209,233,106,109,136,243, 18,
+	 32,169,244,171,254, 45,169, 46,157,187, 34, 73,149, 33, 86, 41,103,  6, 98, 20,
+	 67,246,177,130,100,213, 62,220,140, 39, 14,  1, 33, 84, 25,110,164, 90,157,252,
+	241,131,105,130,133, 12,176,178, 30, 28,147,176,  4,248, 27,230,163, 87,170, 75,
+	131,129,191,239,146, 10, 50,115,116, 60,173, 95, 24,168, 69,216,152,135,207,  6,
+	252,122,183,230,200,219,219,154,159, 51,198,189, 45,127,169,233,164, 87,252,240,
+	 47, 76, 49, 30, 41, 85,184,217,115, 29, 82,122,131,212,252, 29, 25,180, 15,134,
+	100,183,133, 27,172,249,  6,175,228,  7,151,194, 12,168,210, 32,101,144, 18,232,
+	 14,  7, 23,198,213, 25,225,135,198, 26,194,173,233,229,156,203,240,244,  9,124,
+	 22, 49, 50, 26, 73,207,151,233,212,232,  0, 36,113,178,163,234,199,129,163,174,
+	142,220, 12, 77, 52,168,  1,196,121,221, 40,  7,186, 36, 33,205, 33, 51, 65,156,
+	 81,142,192, 99,135,209,195, 70,184,167,178,169,183,195,243,104, 68,138, 54,184,
+	 74,148,251,164, 25,131,193, 49, 96,130, 58, 72, 37, 18, 10,106,182,237,229, 36,
+	172,215,169, 77,217,239, 68,156,106,144,141, 50, 26, 43,  4,174, 17, 16,142, 25,
+	140,213, 43, 96, 59,213,134,152,252,140,246,235, 24,111,232,186, 71,113,124, 67,
+	 36,196,134,194,104, 37, 28,225,235, 92,160, 36,148,204, 91,160,127,255,190, 30,
+	150, 16,184,146,115,251,  1,136,169,184,189,248,142,164,117,  4,192, 55,147,182,
+	241,157, 71,253,193, 80,206,117, 24,135, 60,113, 74, 61, 12,130,158,226, 97,185,
+	 39,107,203,158,217, 74,173,100,223,189,131, 98,233,182,119,162,222, 42, 18,107,
+	 74,154,  9,234, 14,114, 19,  1,109, 64,181, 25,245,126, 90,144,212, 25,225,217,
+	226, 61,244, 54, 83,164, 38,212, 52,209, 87, 61, 91,228,130,216,230,240,118, 47,
+	255,202, 12,178, 68,212, 25,254,222,166,123, 13,207,198, 94, 13, 24,160, 90,124,
+	 34, 78,225, 47, 23, 19, 69,201,200, 71, 26, 18,191,113, 14,213, 13,113,126,171,
+	152,106, 84, 13, 74,165,126,253, 62, 81,242,149, 38,173, 52,205,105,125,144, 48,
+	141, 62,213, 41, 89,131,143,172, 61,218, 39, 80, 25, 76,  2,224,247,243, 39, 35,
+	 29,151,175,176,139, 37, 65,  6, 64, 18, 57,138,  1,129,140,126,230,250, 61,124,
+	 91,167,217, 25,202,  2,  9,  2,145,214,247, 94, 59,150,102, 43,101, 34,231, 51,
+	214,131, 45, 40,115, 72,102,251, 54,110,132,148,178,116,210,218,197, 43,  4,247,
+	 43,167, 68,107, 69,181,112,215,220,117, 59, 90, 29, 67,212, 19,109,247,254,110,
+	189,225,168,212, 30,182, 29,188, 23,104,192,244, 64,251, 71, 40, 38, 61, 29, 37,
+	 97,140, 63,201, 41, 25,211,213,207,182, 22, 67,235,219,202, 41,154,180,  8,109,
+	237, 93,  8,243,206,238, 72,245, 67,202,218,151,110,100,145,184,178,225,244, 55,
+	180,226, 37, 40,221,106,  6,224, 10, 32,116, 83, 66,143,215, 17,187,246,230,207,
+	102,211,139,226,213,238,112,194,104,185, 67,204,142,144,245,132, 83,232,216,  0,
+	255,235, 13, 46,101,118,114,206,236,183, 76,227,175,195,196,120,101, 20, 78,244,
+	 23, 70,143, 15,112,249,162,205,108,159,153, 77,  3,158,153,241,173, 75, 74,227,
+	254, 57,201,166, 15,134, 52, 13,172,227,216,140,121,243,173,  4,162,130,185,135,
+	195, 66,115, 82,197,119,229,229, 12,213, 97, 22,  5,220, 73,131,194,240,102,246,
+	 11, 65, 52,107,161, 21,138,215, 44, 96, 59,155,146,100,136, 38, 54, 85,250,102,
+	 44, 55,251,  6,224,109, 39,171, 35,116,173,249, 53,228,  9, 43, 16, 37,244,247,
+	193,150,146,169,104,  1, 86, 50, 69, 56, 31, 24,116, 69,113,227, 45,112,166, 84,
+	195, 31,213, 28, 46,208,224, 95, 54,145,141, 43,212,135, 82,211,157,135,197, 48,
+	117,160,188, 84, 58,204,130,232,188,248,138,184, 81, 71,135,151, 76, 29, 71,190,
+	 28,144,190,198,132,163,130, 18,249,174,241,164,160,111, 61,202,241, 65, 90, 26,
+	147,137, 47,229,179,124,246,249,146, 75,  2,207, 12,115, 27, 40,157,113, 95,103,
+	157, 86,179, 34,166,186,150,157, 32, 73, 42,175, 26,170, 29, 71, 28,245,230,  2,
+	109,174,138,130, 27, 11,146,197,201,144,132,123, 82,221,169, 71,212,246,235, 49,
+	113,220,248,145, 99, 13,122, 72,167,  3, 65,209, 38, 49,134,233,255,181, 78,  3,
+	 85, 53, 76,166,122,141, 66, 11, 84,148, 72, 58,228,146,185, 22,230,125,162,214,
+	 92, 66,218,162,150,190,163,215, 94, 42, 31,144,251,125, 65, 36,244,253, 82, 65,
+	146,  9,191, 68, 76,223, 41,127, 17,146,222, 47,131, 13,180,153,133, 40,186, 19,
+	 93,232,229,179,160, 77,  3,155,245,232, 78,231,167,136, 27, 43,214,188,187, 65,
+	143, 21,237, 91, 21,213,115,204,117, 75,232,105,154,132,230, 99,181, 56, 45, 58,
+	183,128, 54, 60, 86,182, 96,216,164,225, 70,122,154,158, 14,237,191,207, 36, 96,
+	249,163, 66,163, 19,113,  5,144, 90,144,117,  7, 57,174, 17, 30, 39, 44, 18,141,
+	207, 60,240,238,123, 65,128,158,221, 46,232,177,254, 65,138,138, 46, 10, 44,204,
+	138,230,165,223,  1, 93, 94, 17,228, 60,155,198,129,126, 14,154,240,146,144,153,
+	 68,130, 60,209,248,  9,156, 31, 98,155,191,182, 95, 40,207, 16, 30, 96, 85, 16,
+	254, 75,195,251,209,  7,126,161,192,243, 63, 16, 57,233, 65, 70, 75,140,244,150,
+	118, 44, 67,212, 35,113, 20,236, 56,135, 29,175,255, 31,108, 94,213,106,192,103,
+	  6,200, 19, 63, 44,144, 92,179,164, 65,163, 68, 72, 79,226,227,120,150,191, 69,
+	136, 41, 38, 78,214,195,229,163,118,134,153,111,122, 83,210, 97, 36,147, 46,118,
+	184, 79,134,138,119, 36,132,  6,168, 85,229, 42, 54,255,239,255,193, 92,159,106,
+	 48, 49, 31, 55,113,160, 58, 60, 49, 95,163, 68, 87,135, 34,106,179,233,209, 27,
+	  7,151, 66,109,156,115, 96,249,169,140,255,173,221, 16,  5,202,229,128,174,165,
+	211,230,145,145,227, 73,223,159, 27, 19,144,145,254, 57,119, 25,168,  0, 71,110,
+	162, 21,189,154, 18,163, 21,107,161,  1, 91,  6,141,172, 27,159,206,111,149,159,
+	203, 29,127, 11,175,230,124,227,100,221, 57,248, 96, 47,207, 78,129,153, 77,  7,
+	197,236,163,109,188,127,128,210, 56,184,210, 98, 14,180,205, 56,147,222, 36,180,
+	163, 72, 92,240,138,224,230, 98,158,150,161, 60,241,138,107, 36,182,146,222,125,
+	188, 97,122,215,164, 48,250,133,118,202, 89, 85,133,  9,186, 29,173,250,  8,146,
+	185, 39,  7, 90,167,189,118, 97, 90,107, 17, 80, 45,  2,206,177,  4, 63, 64, 78,
+	 35, 97,236, 27,135,206,231, 88,232,229, 96,247,239,206, 99,112,191,244, 96,243,
+	 62, 15, 69,110,140,135, 48, 46,131,107, 46,207,243, 38,237,162, 99,117,208,228,
+	 62, 50, 60,176,125,185, 47,104, 19, 73, 31, 55,228, 76, 79,248,236,  8, 67,168,
+	 93,232, 10, 18,117,131,226,233,151, 46,238,226,169,138, 48, 29,189,116, 28,240,
+	247,160,140, 20, 43, 77, 77,171, 41, 73,125, 78, 65,179,152,229,177, 98,175,233,
+	157,246, 56,175,221,174,210,224,118, 47,222, 22,100,141, 90,141,189,145, 46, 11,
+	  3, 42,  7,104,  4,161, 24, 75,182,139,  5,198,146,240,234,131, 66,170,204, 28,
+	 19,239, 31,134,141,  5,237, 33,183, 64,115,124,156,136,106,205,221, 93, 88, 38,
+	108,110, 57,117,185,236, 32,180, 74,100,136,238, 93,194, 35,125,105, 16,253, 86,
+	172,211, 15, 86,244,153,121,144,224,118, 55, 52,144,  4,242, 67,181,231, 48, 46,
+	113,182,252,  3, 13, 73,252,135, 45,163,228,219, 38,249, 97,224,238, 42, 47, 92,
+	247,176,204, 25,129,130,223,196, 43, 16,198,117,158,142, 62, 16,239,176,200, 73,
+	226,204, 29, 11,  2,127, 84, 48, 99,106,162,169, 57,239,159, 23,238, 15,189,163,
+	137, 42,168,181,166, 34,188,169, 73,190, 42, 90,247, 17,165, 68, 59,163,201, 31,
+	 24,101, 16,103,  4,136,  3, 67,105, 58,185,  9, 99,203, 25, 78, 50, 10,136,190,
+	 69,243,103,120, 52,162,102,131,137,150,  8,  3, 25,188,158,190,114, 94, 44,247,
+	 22, 75, 15, 52,190,107,224,254, 67,110, 13, 48,143,171, 79, 54, 67, 27,131,109,
+	111, 54,225,149,100,167,210, 36,255,179,152,255,159,120,125,220,249,205, 11, 21,
+	 83,127,205,107, 58, 24,191,253, 23,  3,193, 97,134,149, 57,160,  2,158,177,176,
+	162,173, 67,  4,147,  0, 55,177,192,206, 45,197,  1, 24,231,185, 16, 82,135,213,
+	 44,137,239,219,185, 25, 91, 49, 27,216,203,150,102,148,184,117,221,  5,197,190,
+	238, 27, 78,188,237,151,119,129,  9,  8, 49,145,155,204,201,228,188, 71,225, 13,
+	  0,222,238, 21,248, 38,148, 65,251,189, 17, 52,215,178,212,152,163, 99,249,  7,
+	217,244, 39,159,165,144,219,226,218,213, 47,160, 58,139,203,114, 20,155,166, 46,
+	234,254,194,160,224,176,136, 70,133,229,162,126,198, 19, 80, 14,183,170,216,142,
+	187,154,171, 15,  5,250,120,136, 12, 73, 16,  0,101, 30,237,116, 84,240,105,236,
+	211, 80, 77, 41,243,169, 72, 71, 21, 89,149,191, 59,250,161,164,118, 72, 73, 13,
+	253, 64,118, 10,123,112,213,191,216,187, 88,103,127, 23,116,218, 13, 53, 63,220,
+	 85,103,167,193, 93, 58,112, 27, 15,198,134,  7,138,113,221,238,214,120, 89, 80,
+	119,127,131,177,121, 11,243,103,119, 38,203,  6,178,103, 53,251, 91,144,178, 28,
+	191, 80, 85,149,112, 35,209,237, 17, 74, 31,111,236, 94,140, 76,254, 58, 61,196,
+	137, 69,143,178,187, 90, 97, 76,140,141, 73,173,160,165, 86,  6,149,150,213,229,
+	 64, 73, 85, 71, 81,155, 13,141, 21, 94, 46,222,241,189, 22, 40, 38, 56,116, 88,
+	152,116,117, 28,118,233, 14,128,220,195,200,126,210,221,243,228, 85,164,204,210,
+	168,207, 29,139, 73,205,242,102,140,202,201,160,230,221, 93,123,205,  7, 80, 67,
+	 35,241, 41, 78,182, 53,198,169,171, 19,152,117, 47,164, 96,124, 26,238, 74,184,
+	255, 93, 20, 74, 25,171, 81,223,226,251,238, 15,220,145, 90,170, 51, 81,  4, 93,
+	 16,247, 67,177, 94, 12,144,168,251,127,233,128, 62, 81, 62, 45, 48,127,130,  4,
+	220,163,202,253,167,254,192,103, 47, 88,122, 36, 54,143,107, 10,211,140,127,142,
+	 21,153,193, 92, 95,201,117, 61,240,237, 60,216,167,201,186, 98, 88, 71, 76,162,
+	209,101,214,235, 80,201,160, 66,221, 30, 70,109,113, 29, 62,249,116,187,106,173,
+	 76, 19, 31,139,204, 88, 68,166,177, 15,255, 98,130,229, 19, 43,214,132,108,126,
+	253, 56,228, 60,153,  4,254,138,156,115,197,165,153,170,255, 52, 31,123, 50,141,
+	110, 56,146,206, 25,174, 16,163, 29,248,114,160, 92,139,183, 22,224, 84, 87, 19,
+	241,142, 65, 39, 66,102,234, 98,154,106,255, 63,152,  1, 73,186, 73,243, 96,172,
+	183,167,100, 59,  0,190,110, 96,131,  8, 55,213,251, 13,106,183,240,244, 38,195,
+	 50, 31, 16,152, 79, 95, 55, 98, 46,142, 97,179,117,215,103,153, 40,114, 71,121,
+	183,114,167, 31,102,148,127,140,199,246,153, 78, 56, 36, 94,218,158,117, 63, 90,
+	 97,169,100,102,152,131,199, 55, 15,226,189,173, 75,  4, 77,213,245,  3, 97,106,
+	 41,104,159,133, 37,128, 88,  8,207,118,172, 70,240, 45, 48,212, 98,210,170,211,
+	 33,237, 84,147,249,190,143, 56, 81,127, 50,148,190,248, 61,200,179,189,121,107,
+	 44,  8, 10,222,129,213,147,111, 96,151, 45, 79,148,252,221,250,119,164,247, 86,
+	 35, 26,127,106,188, 17, 12,229,126,148, 13, 77,172,180,130,153, 21, 83,120,179,
+	 51,224, 87, 26,202,211,214,177,182,215, 15,166, 42,107,246, 49, 28, 10,159, 45,
+	105, 58, 47, 98,109, 96,197, 73,210, 86,184,125, 89,138, 93, 14,138,252, 34, 69,
+	  6, 85, 65,172,  7,124,172,  2, 89, 89,191,131,123,218,246, 71,245, 31,219,149,
+	 23,191,232, 89,118,182, 91,128,134, 18,112, 94,221,108, 97,230,114, 57,244, 36,
+	161,153, 97,  9,141, 46, 52, 49, 72,105,185, 65, 99,228,251,147, 65, 26,230, 87,
+	219,186,147, 21,255, 39,125,133,153,166, 59, 49,217,187, 45, 25, 83, 17,129,166,
+	229,166, 63,224,232,146,222, 22,100,187, 18, 77, 98,150,213,136,  6,183,247,120,
+	219,240,193, 84,  0,107, 66,192,212, 80, 91,249,202,128,183,247, 35,142, 78, 71,
+	208, 87,133,167,104,158,206,130,145,195,136,218, 89,204,134, 87,139,249,249,191,
+	228, 93,223,182,230, 22,234,203,159, 58,186,223, 27,220,223,250, 17,238,185,246,
+	230,102,206,241, 46, 30,228,191, 91,  4, 57, 25,244, 25,112,112,213,109, 53,203,
+	 92,135, 96, 62,195,165,195, 92, 60,  8,210,235,  0,137,101, 18,159,110,135, 63,
+	103, 28, 54,135, 14,229,160, 57, 28,204, 64,103, 25,211,180,118,112,251,130,204,
+	212, 43,222, 18,163,136, 89,230, 61, 55,116,239, 91,209,224,188, 70, 48,  7,184,
+	211,187, 76, 90,187,164,123,  7,140,115, 82,  2,218,139, 79,150, 96, 26,206,255,
+	 91, 55,129, 16, 38,217, 90,174,253, 99,249,202,170, 65, 73, 76, 89, 95,123, 56,
+	 40,132,253,104, 69,122,224, 41,247,229, 48,  6,171, 34,214,216, 28, 24, 43, 58,
+	211, 35, 30, 61, 69,125, 75,191,156, 44, 15,187,248,  4, 87,116, 50,168, 74,126,
+	240, 61, 18,100,192,183,191, 69, 38,225,209, 58,231,207, 76, 56, 84, 54,122, 92,
+	128,169, 24,184, 49,194, 97,108, 62,249, 68, 61, 58, 14,123,107,213, 13,235,222,
+	 80,245, 48,166, 46,155,119, 76, 10,172,165,160,231,215, 95,172,201,132, 33,246,
+	160,227, 72,145,230,  2, 34,116,247,191,171, 20, 26, 11, 27, 97, 96, 48,116, 59,
+	160, 34, 90, 28,176,207, 74,169,248,180, 87,176,  6, 78,106, 96,237, 64,184, 75,
+	 36,120,149, 95,120,106, 45,180,148, 58,177,108,168, 39, 53, 30,235,100,147,209,
+	101,106,113, 95,  5,  3,173,225,210,253, 90,190,228,251,179,168, 55,247, 43,131,
+	 60,216,143, 93,246,229, 78, 77,161,130, 19,129,108,114,253,142,147, 12,125,159,
+	 60, 45, 84,192, 66,216, 64,172, 34,107,249,198,137,161,232,  9, 46,157,253, 67,
+	 36,117,100, 19,108, 67,218,223,132,133, 12, 53, 99,  3,148,230,233,205,243, 74,
+	125, 98,  0, 35, 48, 59,204,218,182,  4,233,254,218,217,223,158,184,139,189, 87,
+	 65,125, 79,219, 58,181,112,185, 24,214,164, 68,138, 67,100,216,111, 87,  4,126,
+	 14,252,220, 22,104, 66, 14,159,197, 29, 47,  8,118,105,191, 47,171, 95, 38, 80,
+	233,145, 26,209,119,212, 49, 24,133,182,142, 30,186,121,114, 19, 71,150,241,135,
+	118,103,159,197,221, 24,135,233,  5,138,203,174, 83,227,184, 39, 23,224, 27, 85,
+	103,122,234, 85, 97,113, 58,205,193,158,140, 29,217,212,172,238,203, 60,213,218,
+	165,  6,116,135,227,128, 35,140, 36,180,166, 93,144,132,186,250,151,150,170,171,
+	175,191,104, 32, 69,172,185,116, 87,141,164,224, 56, 98,157, 68, 68, 17,106, 14,
+	 45,171,222, 89, 83, 75, 25,103,179,238, 31,224, 44, 73,177, 94, 87,213,161, 87,
+	128, 32, 51,  5, 59,225, 31, 29,198, 74, 68,241,104, 15, 71,128, 84,240,103, 64,
+	 74,207,179, 80, 50, 93,  3, 73,254,236,107, 64,188,135, 10,241,235,114,161,242,
+	158,148, 66,155,197,119, 76,  9,153,117,217,227, 40,119, 33,223,230, 66,102,196,
+	142,145,189,179, 15,122,177, 46, 92,107, 83,  2,247,190,239,163, 97, 49, 46,152,
+	142,226, 70,192,254,226,251,136,163,158,243, 74,225,113,222,127,157,151,249,194,
+	246,244,184, 64,103, 56,203, 52,  0,  0};
\ No newline at end of file
@@ -0,0 +1,838 @@
+/*
+Build:
+g++ -std=c++17 -O2 -pthread -march=broadwell bench.cpp -o bench
+
+Run:
+bench tt_stress [threads] [seconds]
+bench new_game [max MB]
+bench prefetch [positions] [depth] [hash MB]
+bench tree [positions] [depth]
+bench movegen [positions] [depth]
+bench accumulator [millions]
+bench eval_exact [plies] [seed]
+bench evaluate [millions]
+bench sparsity [positions] [depth]
+bench eval_cache [positions] [depth]
+bench weights_blob [file]
+bench startup [runs] [blob file]
+bench decode [runs]
+bench input_latency [trials] [threads]
+
+Search features set in main.cpp's configuration can be compared by building twice,
+e.g. with -DPVS=0 or -DASPIRATION_DEPTH=64.
+
+Development benchmarks and stress tests. This builds the engine (main.cpp) with its
+optional parts (such as SMP) but without its main(), and drives it directly; it is not
+part of the Kaggle submission.
+*/
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#define NO_MAIN 1
+#define SMP 1
+#define TT_RESIZE 1
+#define OLD_MOVEGEN 1
+#define NNUE_STATS 1
+#define NNUE_LOAD_BLOB 1
+#define EVAL_CACHE 1
+#include "main.cpp"
+#include "openings.cpp"
+
+/////////////////////////////////////////////////////////////////////////////
+//Helpers
+/////////////////////////////////////////////////////////////////////////////
+
+uint64_t now_ns()
+{
+	timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return static_cast<uint64_t>(now.tv_sec) * 1000000000ull + now.tv_nsec;
+}
+
+Engine engine;
+
+struct SearchStats
+{
+	uint64_t nodes;
+	uint64_t qnodes;
+	uint64_t ns;
+	uint64_t researches;
+	uint64_t aspiration_fail_lows;
+	uint64_t aspiration_fail_highs;
+	uint64_t eval_probes;
+	uint64_t eval_hits;
+	uint64_t iteration_nodes[MAX_PLY];
+};
+
+//Fixed-depth searches of n_positions openings from the first, each from a cleared TT and
+//history so that runs are reproducible
+SearchStats search_positions(int n_positions, int depth, int first = 0)
+{
+	SearchStats total{};
+	engine.depth_limit = depth;
+	engine.time_manager.limits = fixed_time(UINT64_MAX);
+	engine.pondering = false;
+	for(int i = first; i < first + n_positions && i < static_cast<int>(std::size(OPENINGS)); ++i)
+	{
+		engine.new_game();
+		engine.board() = Board(OPENINGS[i]);
+		clock_gettime(CLOCK_MONOTONIC, &engine.think_time_start);
+		uint64_t start = now_ns();
+		engine.search();
+		total.ns += now_ns() - start;
+		total.nodes += engine.threads[0]->nodes;
+		total.qnodes += engine.threads[0]->qnodes;
+		total.researches += engine.threads[0]->researches;
+		total.aspiration_fail_lows += engine.threads[0]->aspiration_fail_lows;
+		total.aspiration_fail_highs += engine.threads[0]->aspiration_fail_highs;
+		total.eval_probes += engine.threads[0]->eval_probes;
+		total.eval_hits += engine.threads[0]->eval_hits;
+		for(int d = 0; d < MAX_PLY; ++d)
+			total.iteration_nodes[d] += engine.threads[0]->iteration_nodes[d];
+	}
+	return total;
+}
+
+void print_search_stats(const char* name, SearchStats s)
+{
+	printf("%-12s nodes=%lu qnodes=%lu time=%.1fms nps=%lu\n", name, s.nodes, s.qnodes, s.ns / 1e6, s.nodes * 1000000000 / (s.ns + 1));
+}
+
+//Per-thread generator, since random64() keeps global state
+uint64_t xorshift(uint64_t& state)
+{
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return state;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//tt_stress: many threads probe and overwrite the same few clusters. Every key
+//always gets the same data, so any entry that comes back with other data
+//means a torn or corrupted read got through.
+/////////////////////////////////////////////////////////////////////////////
+
+struct StressThread
+{
+	pthread_t thread;
+	int id;
+	uint64_t seconds;
+	uint64_t probes;
+	uint64_t hits;
+	uint64_t writes;
+	uint64_t corrupt;
+};
+
+//16 clusters (selected by the top bits, which drive the TT index) with 64 nonzero resolvers each
+uint64_t stress_key(uint64_t r)
+{
+	return (r & 15) << 60 | ((r >> 4 & 63) + 1) * 0x9E3779B1ull;
+}
+
+TranspositionTable tt;
+
+TTEntry stress_data(uint64_t key)
+{
+	uint64_t x = key * 0xD6E8FEB86659FD93ull;
+	TTEntry entry;
+	entry.hash = static_cast<Collision_Resolver>(key);
+	entry.move = static_cast<uint16_t>(x >> 16);
+	entry.static_eval = static_cast<Value>(x >> 32 & 0x3FFF);
+	entry.search_eval = static_cast<Value>(x >> 48 & 0x3FFF);
+	entry.depth = static_cast<uint8_t>(x >> 8);
+	entry.gen_and_bound = tt.gen | (1 + x % 3);
+	return entry;
+}
+
+void* stress_main(void* arg)
+{
+	StressThread& t = *static_cast<StressThread*>(arg);
+	uint64_t state = 0x9E3779B97F4A7C15ull * (t.id + 1);
+	uint64_t end = now_ns() + t.seconds * 1000000000ull;
+
+	while(now_ns() < end)
+	{
+		for(int i = 0; i < 4096; ++i)
+		{
+			uint64_t r = xorshift(state);
+			uint64_t key = stress_key(r);
+			TTEntry expected = stress_data(key);
+			TTRef ttRef = tt.get(key);
+			t.probes++;
+
+			if(ttRef.found)
+			{
+				t.hits++;
+				const TTEntry& e = ttRef.entry;
+				if(e.move != expected.move || e.static_eval != expected.static_eval || e.search_eval != expected.search_eval
+					|| e.depth != expected.depth || (e.gen_and_bound & 3) != (expected.gen_and_bound & 3))
+					t.corrupt++;
+			}
+
+			if(!ttRef.found || (r >> 40 & 7) == 0)
+			{
+				ttRef.write(key, expected.move, expected.static_eval, expected.search_eval, expected.depth, expected.gen_and_bound & 3);
+				t.writes++;
+			}
+		}
+	}
+	return nullptr;
+}
+
+int tt_stress(int n_threads, uint64_t seconds)
+{
+	static StressThread threads[MAX_THREADS];
+	n_threads = std::clamp(n_threads, 1, MAX_THREADS);
+	printf("tt_stress: %d threads, %lu seconds\n", n_threads, seconds);
+
+	tt.init(TT_CLUSTERS);
+	tt.clear();
+	for(int i = 0; i < n_threads; ++i)
+	{
+		threads[i] = StressThread{};
+		threads[i].id = i;
+		threads[i].seconds = seconds;
+		pthread_create(&threads[i].thread, nullptr, stress_main, &threads[i]);
+	}
+
+	StressThread total{};
+	for(int i = 0; i < n_threads; ++i)
+	{
+		pthread_join(threads[i].thread, nullptr);
+		printf("thread %d: probes=%lu hits=%lu writes=%lu corrupt=%lu\n", i, threads[i].probes, threads[i].hits, threads[i].writes, threads[i].corrupt);
+		total.probes += threads[i].probes;
+		total.hits += threads[i].hits;
+		total.writes += threads[i].writes;
+		total.corrupt += threads[i].corrupt;
+	}
+	printf("total: probes=%lu hits=%lu writes=%lu corrupt=%lu\n", total.probes, total.hits, total.writes, total.corrupt);
+	printf("%s\n", total.corrupt ? "FAILED" : "OK");
+
+	return total.corrupt ? 1 : 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//new_game: latency of clearing the TT for a new game at increasing table sizes,
+//compared with eagerly rewriting every entry
+/////////////////////////////////////////////////////////////////////////////
+
+int new_game(uint64_t max_mb)
+{
+	printf("%10s %10s %14s %14s\n", "MB", "page", "eager (us)", "clear (us)");
+	for(uint64_t mb = 1; mb <= max_mb; mb *= 2)
+	{
+		tt.init(mb * 1024 * 1024 / sizeof(TTCluster));
+		uint64_t page = tt.page_size();
+		
+		uint64_t start = now_ns();
+		for(uint64_t i = 0; i < tt.n_clusters; ++i)
+			for(int j = 0; j < ENTRIES_PER_CLUSTER; ++j)
+				tt.clusters[i].entries[j].store(TTEntry{0, Move::NO_MOVE, TT_NO_VALUE, TT_NO_VALUE, 0, 0});
+		uint64_t eager = now_ns() - start;
+		
+		start = now_ns();
+		tt.clear();
+		uint64_t logical = now_ns() - start;
+		
+		printf("%10lu %10lu %14.1f %14.3f\n", mb, page, eager / 1000.0, logical / 1000.0);
+	}
+	return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//prefetch: NPS with and without the TT prefetch in Board::makeMove(). The trees
+//are identical, so only the speed differs.
+/////////////////////////////////////////////////////////////////////////////
+
+int prefetch(int n_positions, int depth)
+{
+	bool prefetch_default = engine.tt.prefetching;
+	printf("prefetch: %d positions, depth %d, %lu clusters, default %s\n", n_positions, depth, engine.tt.n_clusters, prefetch_default ? "on" : "off");
+	for(int run = 0; run < 2; ++run)
+	{
+		for(bool on : {true, false})
+		{
+			engine.tt.prefetching = on;
+			print_search_stats(on ? "prefetch on" : "prefetch off", search_positions(n_positions, depth));
+		}
+	}
+	engine.tt.prefetching = prefetch_default;
+	return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//tree: size of the search tree per iteration at a fixed depth
+/////////////////////////////////////////////////////////////////////////////
+
+int tree(int n_positions, int depth)
+{
+	printf("tree: %d positions, depth %d, PVS=%d, aspiration depth %d window %d\n", n_positions, depth, PVS, ASPIRATION_DEPTH, ASPIRATION_WINDOW);
+	SearchStats s = search_positions(n_positions, depth);
+	for(int d = 1; d <= depth; ++d)
+		printf("depth %2d: %lu nodes\n", d, s.iteration_nodes[d]);
+	print_search_stats("total", s);
+	printf("re-searches=%lu aspiration fail lows=%lu fail highs=%lu\n", s.researches, s.aspiration_fail_lows, s.aspiration_fail_highs);
+	return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//movegen: time to depth and NPS of the staged move generation against generating,
+//scoring and sorting all moves up front. Move ordering differs, so the trees do too.
+//The two alternate position by position, so that clock speed drift hits both alike.
+/////////////////////////////////////////////////////////////////////////////
+
+int compare_movegen(int n_positions, int depth)
+{
+	printf("movegen: %d positions, each depth searched from a cleared TT\n", n_positions);
+	printf("%5s %10s %10s %8s %10s %10s %8s %8s\n", "", "all", "", "", "staged", "", "", "");
+	printf("%5s %10s %10s %8s %10s %10s %8s %8s\n", "depth", "ms", "nodes", "knps", "ms", "nodes", "knps", "speedup");
+	for(int d = 1; d <= depth; ++d)
+	{
+		SearchStats all{};
+		SearchStats staged{};
+		for(int i = 0; i < n_positions; ++i)
+		{
+			for(int k = 0; k < 2; ++k)
+			{
+				engine.staged_movegen = (i + k) & 1;
+				SearchStats s = search_positions(1, d, i);
+				SearchStats& total = engine.staged_movegen ? staged : all;
+				total.nodes += s.nodes;
+				total.ns += s.ns;
+			}
+		}
+		engine.staged_movegen = true;
+		printf("%5d %10.1f %10lu %8lu %10.1f %10lu %8lu %8.2f\n", d, all.ns / 1e6, all.nodes, all.nodes * 1000000 / (all.ns + 1),
+			staged.ns / 1e6, staged.nodes, staged.nodes * 1000000 / (staged.ns + 1), static_cast<double>(all.ns) / (staged.ns + 1));
+	}
+	return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//accumulator: NNUE accumulator updates per second for a quiet move, a capture and
+//castling, fused (nnue::update_accumulator) and one feature at a time as before
+/////////////////////////////////////////////////////////////////////////////
+
+void update_separately(const nnue::Accumulator& from, nnue::Accumulator& to, const nnue::AccumulatorDelta& delta)
+{
+	to = from;
+	for(int i = 0; i < delta.n_removed; ++i)
+		nnue::remove_accumulator(to, delta.removed[i][0], delta.removed[i][1]);
+	for(int i = 0; i < delta.n_added; ++i)
+		nnue::add_accumulator(to, delta.added[i][0], delta.added[i][1]);
+}
+
+//Each update reads the parent and writes the child, as in the search. Best of 5 runs,
+//since short runs on a shared machine are noisy.
+template<typename Update>
+double updates_per_second(Update update, const nnue::Accumulator& parent, const nnue::AccumulatorDelta& delta, uint64_t n)
+{
+	static nnue::Accumulator child;
+	double best = 0;
+	for(int run = 0; run < 5; ++run)
+	{
+		uint64_t start = now_ns();
+		for(uint64_t i = 0; i < n; ++i)
+		{
+			update(parent, child, delta);
+			asm volatile("" ::: "memory");
+		}
+		best = std::max(best, n * 1e9 / (now_ns() - start));
+	}
+	return best;
+}
+
+int accumulator(uint64_t millions)
+{
+	Board board;
+	nnue::Accumulator parent = board.accumulator();
+	
+	//Pieces are numbered as in chess::Piece: white pawn..king = 0..5, black = 6..11
+	struct { const char* name; nnue::AccumulatorDelta delta; } moves[] = {
+		{"quiet", {1, 1, {{1, 6}}, {{1, 21}}}},                //Ng1-f3
+		{"capture", {2, 1, {{6, 35}, {0, 28}}, {{0, 35}}}},    //exd5
+		{"castling", {2, 2, {{5, 4}, {3, 7}}, {{5, 6}, {3, 5}}}},  //O-O
+	};
+	
+	int mismatches = 0;
+	printf("%-10s %16s %16s\n", "move", "fused (M/s)", "separate (M/s)");
+	for(auto& m : moves)
+	{
+		nnue::Accumulator fused, separate;
+		nnue::update_accumulator(parent, fused, m.delta);
+		update_separately(parent, separate, m.delta);
+		if(memcmp(&fused, &separate, sizeof(fused)) != 0)
+			mismatches++;
+		
+		double f = updates_per_second(nnue::update_accumulator, parent, m.delta, millions * 1000000);
+		double s = updates_per_second(update_separately, parent, m.delta, millions * 1000000);
+		printf("%-10s %16.1f %16.1f\n", m.name, f / 1e6, s / 1e6);
+	}
+	printf("%s\n", mismatches ? "MISMATCH" : "OK");
+	return mismatches ? 1 : 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//eval_exact: the incrementally updated int16 accumulator against an int32 one summed
+//from scratch, over random games of up to `plies` moves from every opening. Both feed
+//the same network, so the evaluations must match exactly.
+/////////////////////////////////////////////////////////////////////////////
+
+int eval_exact(int plies, uint64_t seed)
+{
+	uint64_t positions = 0, mismatches = 0;
+	int32_t low = 0, high = 0;
+	for(const char* fen : OPENINGS)
+	{
+		Board board(fen);
+		for(int ply = 0; ply <= plies; ++ply)
+		{
+			//Skip some positions so that accumulator() sometimes catches up several moves
+			if(xorshift(seed) % 4 != 0)
+			{
+				alignas(32) int32_t scratch[2][INPUT_LAYER];
+				for(int p = 0; p < 2; ++p)
+					for(int i = 0; i < INPUT_LAYER; ++i)
+						scratch[p][i] = nnue::l1_bias[i];
+				for(int sq = 0; sq < 64; ++sq)
+				{
+					int piece = static_cast<int>(board.at(Square(sq)));
+					if(piece == static_cast<int>(Piece::NONE))
+						continue;
+					for(int p = 0; p < 2; ++p)
+					{
+						const int16_t* row = nnue::pst_row(p, piece, sq);
+						for(int i = 0; i < INPUT_LAYER; ++i)
+							scratch[p][i] += row[i];
+					}
+				}
+				
+				const nnue::Accumulator& acc = board.accumulator();
+				int bucket = nnue::output_bucket(acc);
+				for(int p = 0; p < 2; ++p)
+				{
+					for(int i = 0; i < INPUT_LAYER; ++i)
+					{
+						low = std::min(low, scratch[p][i]);
+						high = std::max(high, scratch[p][i]);
+					}
+					if(nnue::evaluate(acc, p) != nnue::evaluate_network(scratch[p], bucket))
+						mismatches++;
+				}
+				positions++;
+			}
+			
+			Movelist moves;
+			movegen::legalmoves(moves, board);
+			if(moves.empty() || board.isHalfMoveDraw())
+				break;
+			board.makeMove(moves[xorshift(seed) % moves.size()]);
+			board.compact();
+		}
+	}
+	
+	printf("positions=%lu accumulator range=%d..%d mismatches=%lu\n", positions, low, high, mismatches);
+	printf("%s\n", mismatches ? "MISMATCH" : "OK");
+	return mismatches ? 1 : 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//evaluate: evaluations per second of the AVX2 nnue::evaluate() and the scalar
+//nnue::evaluate_network() over accumulators from random games
+/////////////////////////////////////////////////////////////////////////////
+
+template<typename Evaluate>
+double evals_per_second(Evaluate evaluate, const std::vector<nnue::Accumulator>& positions, uint64_t n, int64_t& checksum)
+{
+	double best = 0;
+	for(int run = 0; run < 5; ++run)
+	{
+		checksum = 0;
+		uint64_t start = now_ns();
+		for(uint64_t i = 0; i < n; ++i)
+			checksum += evaluate(positions[i % positions.size()], i & 1);
+		best = std::max(best, n * 1e9 / (now_ns() - start));
+	}
+	return best;
+}
+
+int evaluate(uint64_t millions)
+{
+	std::vector<nnue::Accumulator> positions;
+	uint64_t seed = 1;
+	for(int i = 0; i < 100; ++i)
+	{
+		Board board(OPENINGS[i]);
+		for(int ply = 0; ply < 100; ++ply)
+		{
+			positions.push_back(board.accumulator());
+			Movelist moves;
+			movegen::legalmoves(moves, board);
+			if(moves.empty())
+				break;
+			board.makeMove(moves[xorshift(seed) % moves.size()]);
+		}
+	}
+	
+	int64_t avx2_sum, scalar_sum;
+	double avx2 = evals_per_second(nnue::evaluate, positions, millions * 1000000, avx2_sum);
+	double scalar = evals_per_second([](const nnue::Accumulator& acc, int p) { return nnue::evaluate_network(acc.values[p], nnue::output_bucket(acc)); },
+		positions, millions * 1000000, scalar_sum);
+	printf("positions=%zu avx2=%.1fM evals/s scalar=%.1fM evals/s\n", positions.size(), avx2 / 1e6, scalar / 1e6);
+	printf("%s\n", avx2_sum == scalar_sum ? "OK" : "MISMATCH");
+	return avx2_sum == scalar_sum ? 0 : 1;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//sparsity: how many of the layer 1 outputs are nonzero in the evaluations of a fixed-depth
+//search, which is the work done by the sparse layer 2 product
+/////////////////////////////////////////////////////////////////////////////
+
+int sparsity(int n_positions, int depth)
+{
+#ifdef NNUE_CRELU
+	printf("sparsity is only collected for the ReLU network\n");
+	return 1;
+#else
+	memset(nnue::l1_active_histogram, 0, sizeof(nnue::l1_active_histogram));
+	print_search_stats("total", search_positions(n_positions, depth));
+	
+	uint64_t evals = 0, active = 0;
+	for(int n = 0; n <= INPUT_LAYER; ++n)
+	{
+		evals += nnue::l1_active_histogram[n];
+		active += n * nnue::l1_active_histogram[n];
+	}
+	printf("evaluations=%lu mean active=%.1f of %d\n", evals, active / (evals + 1e-9), INPUT_LAYER);
+	for(int n = 0; n <= INPUT_LAYER; n += 4)
+	{
+		uint64_t count = 0;
+		for(int i = n; i < n + 4 && i <= INPUT_LAYER; ++i)
+			count += nnue::l1_active_histogram[i];
+		printf("%2d-%2d active: %5.1f%%\n", n, std::min(n + 3, INPUT_LAYER), 100.0 * count / (evals + 1e-9));
+	}
+	return 0;
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//eval_cache: hit rate and speed of the eval cache at increasing sizes, starting
+//each size from an empty cache. The trees are identical, so only the speed differs.
+/////////////////////////////////////////////////////////////////////////////
+
+int eval_cache_sizes(int n_positions, int depth)
+{
+	printf("eval_cache: %d positions, depth %d, default %d entries\n", n_positions, depth, EVAL_CACHE_ENTRIES);
+	printf("%8s %12s %12s %8s %10s %10s\n", "KB", "probes", "hits", "rate", "time (ms)", "nps");
+	for(uint64_t kb : {0, 16, 64, 256, 1024, 4096})
+	{
+		engine.eval_cache.init(kb * 1024 / sizeof(uint64_t));
+		SearchStats s = search_positions(n_positions, depth);
+		printf("%8lu %12lu %12lu %7.1f%% %10.1f %10lu\n", kb, s.eval_probes, s.eval_hits, 100.0 * s.eval_hits / (s.eval_probes + 1e-9),
+			s.ns / 1e6, s.nodes * 1000000000 / (s.ns + 1));
+	}
+	engine.eval_cache.init(EVAL_CACHE_ENTRIES);
+	return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//weights_blob: writes the decoded weights as a blob for main's -w option, or for
+//building them in with -DNNUE_BLOB=\"file\"
+//startup: time to get the weights ready by decoding the compressed data, from a
+//blob file (as with -w), and from a blob already in memory (as with NNUE_BLOB)
+/////////////////////////////////////////////////////////////////////////////
+
+int weights_blob(const char* path)
+{
+	nnue::init(nullptr, 0);
+	nnue::WeightsHeader header = nnue::weights_header();
+	FILE* f = fopen(path, "wb");
+	if(!f)
+	{
+		printf("cannot write %s\n", path);
+		return 1;
+	}
+	fwrite(&header, sizeof(header), 1, f);
+	for(auto& a : nnue::weight_arrays)
+		fwrite(a.data, a.size, 1, f);
+	fclose(f);
+	printf("%s: %lu bytes\n", path, sizeof(header) + header.bytes);
+	return 0;
+}
+
+int startup(int runs, const char* path)
+{
+	if(weights_blob(path))
+		return 1;
+	FILE* f = fopen(path, "rb");
+	std::vector<uint8_t> blob(sizeof(nnue::WeightsHeader) + nnue::weights_header().bytes);
+	if(fread(blob.data(), blob.size(), 1, f) != 1)
+		return 1;
+	fclose(f);
+	
+	std::vector<uint64_t> times[3];
+	for(int run = 0; run < runs; ++run)
+	{
+		uint64_t start = now_ns();
+		nnue::init(nullptr, 0);
+		times[0].push_back(now_ns() - start);
+		
+		start = now_ns();
+		nnue::load_weights_file(path);
+		times[1].push_back(now_ns() - start);
+		
+		start = now_ns();
+		nnue::init(blob.data(), blob.size());
+		times[2].push_back(now_ns() - start);
+	}
+	
+	const char* names[] = {"decode", "blob file", "blob in memory"};
+	printf("%-16s %12s %12s\n", "weights", "min (us)", "median (us)");
+	for(int i = 0; i < 3; ++i)
+	{
+		std::sort(times[i].begin(), times[i].end());
+		printf("%-16s %12.1f %12.1f\n", names[i], times[i][0] / 1000.0, times[i][times[i].size() / 2] / 1000.0);
+	}
+	return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//decode: time to decode the compressed weights (NNUE_FILE) with nnue::Decoder and
+//with the one-bit-per-call decoder it replaced, which must give the same weights
+/////////////////////////////////////////////////////////////////////////////
+
+struct ReferenceDecoder
+{
+	uint32_t h = 1, c = 0, i = 0;
+	
+	bool decode(uint32_t p)
+	{
+		while(h < 16384)
+		{
+			h *= 256;
+			c *= 256;
+			c += nnue::compressed_data[i++];
+		}
+		uint32_t t = h * p >> 8;
+		if(c < t)
+		{
+			h = t;
+			return false;
+		}
+		else
+		{
+			c -= t;
+			h -= t;
+			return true;
+		}
+	}
+	
+	int32_t next_int()
+	{
+		int exp = 0;
+		while(decode(nnue::thresholds[exp]))
+			exp += 1;
+		
+		if(exp == 0)
+			return 0;
+		
+		int x = 0;
+		int sign = decode(128) ? -1 : 1;
+		for(int i = 0; i < exp - 1; ++i)
+			x += decode(128) << i;
+		x += 1 << (exp - 1);
+		
+		return sign * x;
+	}
+};
+
+//Weights in the compressed data: pawns have no weights on the first and last ranks
+const int N_WEIGHTS = 12 * 64 * INPUT_LAYER - 2 * 16 * INPUT_LAYER + INPUT_LAYER + 4 * (INPUT_LAYER * HIDDEN1 + HIDDEN1 + HIDDEN1 * HIDDEN2 + 2 * HIDDEN2 + 1);
+
+template<typename Decoder>
+uint64_t decode_ns(std::vector<int32_t>& out)
+{
+	uint64_t start = now_ns();
+	Decoder d;
+	for(int i = 0; i < N_WEIGHTS; ++i)
+		out[i] = d.next_int();
+	return now_ns() - start;
+}
+
+int decode(int runs)
+{
+	std::vector<int32_t> weights(N_WEIGHTS), reference(N_WEIGHTS);
+	std::vector<uint64_t> times[3];
+	for(int run = 0; run < runs; ++run)
+	{
+		times[0].push_back(decode_ns<nnue::Decoder>(weights));
+		times[1].push_back(decode_ns<ReferenceDecoder>(reference));
+		uint64_t start = now_ns();
+		nnue::decode_weights();
+		times[2].push_back(now_ns() - start);
+	}
+	
+	int mismatches = 0;
+	for(int i = 0; i < N_WEIGHTS; ++i)
+		mismatches += weights[i] != reference[i];
+	
+	const char* names[] = {"Decoder", "one bit per call", "decode_weights()"};
+	printf("decode: %s, %d weights, %zu bytes\n", NNUE_FILE, N_WEIGHTS, sizeof(nnue::compressed_data));
+	printf("%-18s %12s %12s\n", "", "min (us)", "median (us)");
+	for(int i = 0; i < 3; ++i)
+	{
+		std::sort(times[i].begin(), times[i].end());
+		printf("%-18s %12.1f %12.1f\n", names[i], times[i][0] / 1000.0, times[i][times[i].size() / 2] / 1000.0);
+	}
+	printf("mismatches: %d\n", mismatches);
+	return mismatches != 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//input_latency: time from a line arriving on stdin to a pondering search returning. stdin
+//is a pipe that a writer thread fills after a random 100-300ms; the old search polled
+//stdin every 4096 main thread nodes, which is shown for comparison.
+/////////////////////////////////////////////////////////////////////////////
+
+struct InputWriter
+{
+	int fd;
+	uint64_t delay_ns;
+	uint64_t sent_ns;
+};
+
+void* input_writer_main(void* arg)
+{
+	InputWriter& w = *static_cast<InputWriter*>(arg);
+	timespec delay = {static_cast<time_t>(w.delay_ns / 1000000000), static_cast<long>(w.delay_ns % 1000000000)};
+	nanosleep(&delay, nullptr);
+	w.sent_ns = now_ns();
+	if(write(w.fd, "x\n", 2) != 2)
+		perror("write");
+	return nullptr;
+}
+
+int input_latency(int trials, int n_threads)
+{
+	int fds[2];
+	if(pipe(fds) != 0 || dup2(fds[0], STDIN_FILENO) < 0)
+	{
+		perror("pipe");
+		return 1;
+	}
+	start_input_thread(engine);
+	engine.set_threads(std::clamp(n_threads, 1, MAX_THREADS));
+	engine.depth_limit = 63;
+	engine.time_manager.limits = fixed_time(UINT64_MAX);
+	printf("input_latency: %d trials, %d threads\n", trials, engine.n_threads);
+	
+	std::vector<uint64_t> latencies;
+	uint64_t nodes = 0, ns = 0, state = 1;
+	for(int i = 0; i < trials; ++i)
+	{
+		engine.new_game();
+		engine.board() = Board(OPENINGS[i % std::size(OPENINGS)]);
+		engine.pondering = true;
+		
+		InputWriter w = {fds[1], 100000000 + xorshift(state) % 200000000, 0};
+		pthread_t writer;
+		pthread_create(&writer, nullptr, input_writer_main, &w);
+		uint64_t start = now_ns();
+		clock_gettime(CLOCK_MONOTONIC, &engine.think_time_start);
+		engine.search();
+		uint64_t end = now_ns();
+		pthread_join(writer, nullptr);
+		
+		char buf[16];
+		read_input(buf, sizeof(buf));
+		if(end < w.sent_ns)
+			continue;  //the search finished by itself
+		latencies.push_back(end - w.sent_ns);
+		nodes += engine.threads[0]->nodes;
+		ns += end - start;
+	}
+	if(latencies.empty())
+		return 1;
+	
+	std::sort(latencies.begin(), latencies.end());
+	double nps = nodes * 1e9 / ns;
+	printf("latency (us): min %.1f median %.1f max %.1f\n", latencies[0] / 1000.0,
+		latencies[latencies.size() / 2] / 1000.0, latencies.back() / 1000.0);
+	printf("main thread nps: %.0f, 4096 node poll interval: %.1f us\n", nps, 4096 * 1e6 / nps);
+	return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char** argv)
+{
+	nnue::init_default();
+	Zobrist::init();
+	engine.init(1, TT_CLUSTERS);
+	engine.eval_cache.init(EVAL_CACHE_ENTRIES);
+
+	if(argc >= 2 && strcmp(argv[1], "tt_stress") == 0)
+		return tt_stress(argc > 2 ? parse_num(argv[2]) : 8, argc > 3 ? parse_num(argv[3]) : 5);
+
+	if(argc >= 2 && strcmp(argv[1], "new_game") == 0)
+		return new_game(argc > 2 ? parse_num(argv[2]) : 1024);
+
+	if(argc >= 2 && strcmp(argv[1], "prefetch") == 0)
+	{
+		if(argc > 4)
+			engine.tt.init(parse_num(argv[4]) * 1024ull * 1024 / sizeof(TTCluster));
+		return prefetch(argc > 2 ? parse_num(argv[2]) : 50, argc > 3 ? parse_num(argv[3]) : 8);
+	}
+
+	if(argc >= 2 && strcmp(argv[1], "tree") == 0)
+		return tree(argc > 2 ? parse_num(argv[2]) : 50, argc > 3 ? parse_num(argv[3]) : 8);
+
+	if(argc >= 2 && strcmp(argv[1], "movegen") == 0)
+		return compare_movegen(argc > 2 ? parse_num(argv[2]) : 50, argc > 3 ? parse_num(argv[3]) : 8);
+
+	if(argc >= 2 && strcmp(argv[1], "accumulator") == 0)
+		return accumulator(argc > 2 ? parse_num(argv[2]) : 10);
+
+	if(argc >= 2 && strcmp(argv[1], "eval_exact") == 0)
+		return eval_exact(argc > 2 ? atoi(argv[2]) : 200, argc > 3 ? atoll(argv[3]) : 1);
+
+	if(argc >= 2 && strcmp(argv[1], "evaluate") == 0)
+		return evaluate(argc > 2 ? atoi(argv[2]) : 10);
+
+	if(argc >= 2 && strcmp(argv[1], "sparsity") == 0)
+		return sparsity(argc > 2 ? atoi(argv[2]) : 50, argc > 3 ? atoi(argv[3]) : 8);
+
+	if(argc >= 2 && strcmp(argv[1], "eval_cache") == 0)
+		return eval_cache_sizes(argc > 2 ? parse_num(argv[2]) : 50, argc > 3 ? parse_num(argv[3]) : 8);
+
+	if(argc >= 2 && strcmp(argv[1], "weights_blob") == 0)
+		return weights_blob(argc > 2 ? argv[2] : "nnue_weights.bin");
+
+	if(argc >= 2 && strcmp(argv[1], "startup") == 0)
+		return startup(argc > 2 ? atoi(argv[2]) : 20, argc > 3 ? argv[3] : "nnue_weights.bin");
+
+	if(argc >= 2 && strcmp(argv[1], "decode") == 0)
+		return decode(argc > 2 ? atoi(argv[2]) : 20);
+
+	if(argc >= 2 && strcmp(argv[1], "input_latency") == 0)
+		return input_latency(argc > 2 ? atoi(argv[2]) : 20, argc > 3 ? atoi(argv[3]) : 1);
+
+	printf("Usage: bench tt_stress [threads] [seconds]\n");
+	printf("       bench new_game [max MB]\n");
+	printf("       bench prefetch [positions] [depth] [hash MB]\n");
+	printf("       bench tree [positions] [depth]\n");
+	printf("       bench movegen [positions] [depth]\n");
+	printf("       bench accumulator [millions]\n");
+	printf("       bench eval_exact [plies] [seed]\n");
+	printf("       bench evaluate [millions]\n");
+	printf("       bench sparsity [positions] [depth]\n");
+	printf("       bench eval_cache [positions] [depth]\n");
+	printf("       bench weights_blob [file]\n");
+	printf("       bench startup [runs] [blob file]\n");
+	printf("       bench decode [runs]\n");
+	printf("       bench input_latency [trials] [threads]\n");
+	return 0;
+}
@@ -565,6 +565,9 @@ class attacks {
         U64 operator()(Bitboard b) const { return (((b & mask)).getBits() * magic) >> shift; }
     };
 
+    // Slow function to calculate the attacks along four rays, given as rank and file steps
+    [[nodiscard]] static Bitboard rayAttacks(Square sq, Bitboard occupied, const std::int8_t steps[8]);
+
     // Slow function to calculate bishop attacks
     [[nodiscard]] static Bitboard bishopAttacks(Square sq, Bitboard occupied);
 
@@ -573,7 +576,7 @@ class attacks {
 
     // Initializes the magic bitboard tables for sliding pieces
     static void initSliders(Square sq, Magic table[], U64 magic,
-                            const std::function<Bitboard(Square, Bitboard)> &attacks);
+                            Bitboard (*attacks)(Square, Bitboard));
 
     // clang-format off
     // pre-calculated lookup table for pawn attacks
@@ -1370,9 +1373,11 @@ class Zobrist {
 };
 }  // namespace chess
 
-void nnue::add_accumulator(int p, int s);
-void nnue::remove_accumulator(int p, int s);
-void nnue::clear_accumulator();
+void nnue::add_accumulator(nnue::Accumulator& acc, int p, int s);
+void nnue::remove_accumulator(nnue::Accumulator& acc, int p, int s);
+void nnue::clear_accumulator(nnue::Accumulator& acc);
+void nnue::update_accumulator(const nnue::Accumulator& from, nnue::Accumulator& to, const nnue::AccumulatorDelta& delta);
+void prefetch_TT(uint64_t hash);
 
 namespace chess {
 
@@ -1490,6 +1495,7 @@ class Board {
 
         //prev_states_.emplace_back(key_, cr_, ep_sq_, hfm_, captured);
         new (&prev_states_[plies_++]) State(key_, cr_, ep_sq_, hfm_, captured);
+        pushAccumulator();
 
         hfm_++;
         
@@ -1498,6 +1504,7 @@ class Board {
 
         if (capture) {
             removePieceInternal(captured, move.to());
+            removeFeature(captured, move.to());
 
             hfm_ = 0;
             key_ ^= Zobrist::piece(captured, move.to());
@@ -1602,6 +1609,11 @@ class Board {
             placePieceInternal(king, kingTo);
             placePieceInternal(rook, rookTo);
 
+            removeFeature(king, move.from());
+            removeFeature(rook, move.to());
+            addFeature(king, kingTo);
+            addFeature(rook, rookTo);
+
             key_ ^= Zobrist::piece(king, move.from()) ^ Zobrist::piece(king, kingTo);
             key_ ^= Zobrist::piece(rook, move.to()) ^ Zobrist::piece(rook, rookTo);
         } else if (move.typeOf() == Move::PROMOTION) {
@@ -1610,6 +1622,8 @@ class Board {
 
             removePieceInternal(piece_pawn, move.from());
             placePieceInternal(piece_prom, move.to());
+            removeFeature(piece_pawn, move.from());
+            addFeature(piece_prom, move.to());
 
             key_ ^= Zobrist::piece(piece_pawn, move.from()) ^ Zobrist::piece(piece_prom, move.to());
         } else {
@@ -1620,6 +1634,8 @@ class Board {
 
             removePieceInternal(piece, move.from());
             placePieceInternal(piece, move.to());
+            removeFeature(piece, move.from());
+            addFeature(piece, move.to());
 
             key_ ^= Zobrist::piece(piece, move.from()) ^ Zobrist::piece(piece, move.to());
         }
@@ -1630,16 +1646,21 @@ class Board {
             const auto piece = Piece(PieceType::PAWN, ~stm_);
 
             removePieceInternal(piece, move.to().ep_square());
+            removeFeature(piece, move.to().ep_square());
 
             key_ ^= Zobrist::piece(piece, move.to().ep_square());
         }
 
         key_ ^= Zobrist::sideToMove();
         stm_ = ~stm_;
+
+        // The search probes this position's TT entry next
+        prefetch_TT(key_);
     }
 
     void unmakeMove(const Move move) {
         const auto& prev = prev_states_[--plies_];
+        popAccumulator();
 
         ep_sq_ = prev.enpassant;
         cr_    = prev.castling;
@@ -1725,6 +1746,8 @@ class Board {
         ep_sq_ = Square::underlying::NO_SQ;
 
         stm_ = ~stm_;
+
+        prefetch_TT(key_);
     }
 
     /**
@@ -1986,6 +2009,20 @@ class Board {
         return hash_key ^ ep_hash ^ stm_hash ^ castling_hash;
     }
 
+    // Brings the accumulator up to date from the last position that was evaluated
+    const nnue::Accumulator& accumulator() {
+        if (!accumulators_[0].computed) refreshAccumulator();
+
+        int i = acc_top_;
+        while (!accumulators_[i].computed) i--;
+        for (++i; i <= acc_top_; ++i) {
+            nnue::update_accumulator(accumulators_[i - 1].accumulator, accumulators_[i].accumulator,
+                                     accumulators_[i].delta);
+            accumulators_[i].computed = true;
+        }
+        return accumulators_[acc_top_].accumulator;
+    }
+
     void compact()
     {
         for (int i = 0; i < hfm_; ++i)
@@ -2007,12 +2044,66 @@ class Board {
     Square ep_sq_      = Square::underlying::NO_SQ;
     uint8_t hfm_       = 0;
 
+    // NNUE accumulators: makeMove pushes the move's changes and unmakeMove pops them. An entry
+    // is only computed from its parent when accumulator() needs it, so nodes that return
+    // without evaluating never touch the NNUE. Entry 0 is computed from scratch.
+    static constexpr int ACCUMULATOR_STACK = 96;
+    struct AccumulatorEntry {
+        nnue::Accumulator accumulator;
+        nnue::AccumulatorDelta delta;
+        bool computed;
+    };
+    AccumulatorEntry accumulators_[ACCUMULATOR_STACK];
+    int acc_top_ = 0;
+
    private:
+    // Computes entry 0 from the pieces on the board, which leaves it the only entry
+    void refreshAccumulator() {
+        auto& entry = accumulators_[0];
+        nnue::clear_accumulator(entry.accumulator);
+        for (int sq = 0; sq < 64; ++sq)
+            if (board_[sq] != Piece::NONE) nnue::add_accumulator(entry.accumulator, static_cast<int>(board_[sq]), sq);
+        entry.computed = true;
+        acc_top_       = 0;
+    }
+
+    void pushAccumulator() {
+        if (acc_top_ == 0 && !accumulators_[0].computed) refreshAccumulator();
+
+        // Out of room: keep only the current position. Unmaking past it refreshes from scratch.
+        if (acc_top_ + 1 == ACCUMULATOR_STACK) {
+            accumulators_[0].accumulator = accumulator();
+            acc_top_                     = 0;
+        }
+
+        auto& entry           = accumulators_[++acc_top_];
+        entry.computed        = false;
+        entry.delta.n_removed = 0;
+        entry.delta.n_added   = 0;
+    }
+
+    void popAccumulator() {
+        if (acc_top_ > 0)
+            acc_top_--;
+        else
+            accumulators_[0].computed = false;
+    }
+
+    void removeFeature(Piece piece, Square sq) {
+        auto& delta                         = accumulators_[acc_top_].delta;
+        delta.removed[delta.n_removed][0]   = static_cast<int>(piece);
+        delta.removed[delta.n_removed++][1] = sq.index();
+    }
+
+    void addFeature(Piece piece, Square sq) {
+        auto& delta                     = accumulators_[acc_top_].delta;
+        delta.added[delta.n_added][0]   = static_cast<int>(piece);
+        delta.added[delta.n_added++][1] = sq.index();
+    }
+
     void removePieceInternal(Piece piece, Square sq) {
         assert(board_[sq.index()] == piece && piece != Piece::NONE);
 
-        nnue::remove_accumulator(static_cast<int>(piece), sq.index());
-
         auto type  = piece.type();
         auto color = piece.color();
         auto index = sq.index();
@@ -2029,8 +2120,6 @@ class Board {
     void placePieceInternal(Piece piece, Square sq) {
         assert(board_[sq.index()] == Piece::NONE);
 
-        nnue::add_accumulator(static_cast<int>(piece), sq.index());
-
         auto type  = piece.type();
         auto color = piece.color();
         auto index = sq.index();
@@ -2049,8 +2138,6 @@ class Board {
         pieces_bb_.fill(0ULL);
         board_.fill(Piece::NONE);
 
-        nnue::clear_accumulator();
-
         // find leading whitespaces and remove them
         while (fen[0] == ' ') fen.remove_prefix(1);
 
@@ -2062,12 +2149,16 @@ class Board {
         const auto half_move  = params[4].has_value() ? *params[4] : "0";
         const auto full_move  = params[5].has_value() ? *params[5] : "1";
 
+        // parsed by hand: std::stoi would pull std::string and its exceptions into the binary
         static auto parseStringViewToInt = [](std::string_view sv) -> std::optional<int> {
             if (!sv.empty() && sv.back() == ';') sv.remove_suffix(1);
-            size_t pos;
-            int value = std::stoi(std::string(sv), &pos);
-            if (pos == sv.size()) return value;
-            return std::nullopt;
+            if (sv.empty()) return std::nullopt;
+            int value = 0;
+            for (char c : sv) {
+                if (c < '0' || c > '9') return std::nullopt;
+                value = value * 10 + (c - '0');
+            }
+            return value;
         };
 
         // Half move clock
@@ -2104,6 +2195,10 @@ class Board {
             }
         }
 
+        // Computed when first needed, so that a board can be built before the weights are loaded
+        accumulators_[0].computed = false;
+        acc_top_                  = 0;
+
         for (char i : castling) {
             if (i == '-') break;
 
@@ -2141,8 +2236,10 @@ class Board {
 
         key_ ^= Zobrist::castling(cr_.hashIndex());
 
+#ifdef DEBUGGING
         if (key_ != zobrist())
             print("ZOBRIST ERROR\n", 15);
+#endif
     }
 
     template <int N>
@@ -2250,78 +2347,33 @@ template <Color::underlying c>
     return atks & occupied;
 }
 
-[[nodiscard]] inline Bitboard attacks::bishopAttacks(Square sq, Bitboard occupied) {
+[[nodiscard]] inline Bitboard attacks::rayAttacks(Square sq, Bitboard occupied, const std::int8_t steps[8]) {
     Bitboard attacks = 0ULL;
 
-    int r, f;
-
-    int br = sq.rank();
-    int bf = sq.file();
-
-    for (r = br + 1, f = bf + 1; Square::is_valid(static_cast<Rank>(r), static_cast<File>(f)); r++, f++) {
-        auto s = Square(static_cast<Rank>(r), static_cast<File>(f)).index();
-        attacks.set(s);
-        if (occupied.check(s)) break;
-    }
-
-    for (r = br - 1, f = bf + 1; Square::is_valid(static_cast<Rank>(r), static_cast<File>(f)); r--, f++) {
-        auto s = Square(static_cast<Rank>(r), static_cast<File>(f)).index();
-        attacks.set(s);
-        if (occupied.check(s)) break;
-    }
-
-    for (r = br + 1, f = bf - 1; Square::is_valid(static_cast<Rank>(r), static_cast<File>(f)); r++, f--) {
-        auto s = Square(static_cast<Rank>(r), static_cast<File>(f)).index();
-        attacks.set(s);
-        if (occupied.check(s)) break;
-    }
-
-    for (r = br - 1, f = bf - 1; Square::is_valid(static_cast<Rank>(r), static_cast<File>(f)); r--, f--) {
-        auto s = Square(static_cast<Rank>(r), static_cast<File>(f)).index();
-        attacks.set(s);
-        if (occupied.check(s)) break;
+    for (int i = 0; i < 8; i += 2) {
+        for (int r = sq.rank() + steps[i], f = sq.file() + steps[i + 1];
+             Square::is_valid(static_cast<Rank>(r), static_cast<File>(f)); r += steps[i], f += steps[i + 1]) {
+            auto s = Square(static_cast<Rank>(r), static_cast<File>(f)).index();
+            attacks.set(s);
+            if (occupied.check(s)) break;
+        }
     }
 
     return attacks;
 }
 
-[[nodiscard]] inline Bitboard attacks::rookAttacks(Square sq, Bitboard occupied) {
-    Bitboard attacks = 0ULL;
-
-    int r, f;
-
-    int rr = sq.rank();
-    int rf = sq.file();
-
-    for (r = rr + 1; Square::is_valid(static_cast<Rank>(r), static_cast<File>(rf)); r++) {
-        auto s = Square(static_cast<Rank>(r), static_cast<File>(rf)).index();
-        attacks.set(s);
-        if (occupied.check(s)) break;
-    }
-
-    for (r = rr - 1; Square::is_valid(static_cast<Rank>(r), static_cast<File>(rf)); r--) {
-        auto s = Square(static_cast<Rank>(r), static_cast<File>(rf)).index();
-        attacks.set(s);
-        if (occupied.check(s)) break;
-    }
-
-    for (f = rf + 1; Square::is_valid(static_cast<Rank>(rr), static_cast<File>(f)); f++) {
-        auto s = Square(static_cast<Rank>(rr), static_cast<File>(f)).index();
-        attacks.set(s);
-        if (occupied.check(s)) break;
-    }
-
-    for (f = rf - 1; Square::is_valid(static_cast<Rank>(rr), static_cast<File>(f)); f--) {
-        auto s = Square(static_cast<Rank>(rr), static_cast<File>(f)).index();
-        attacks.set(s);
-        if (occupied.check(s)) break;
-    }
+[[nodiscard]] inline Bitboard attacks::bishopAttacks(Square sq, Bitboard occupied) {
+    static constexpr std::int8_t steps[8] = {1, 1, -1, 1, 1, -1, -1, -1};
+    return rayAttacks(sq, occupied, steps);
+}
 
-    return attacks;
+[[nodiscard]] inline Bitboard attacks::rookAttacks(Square sq, Bitboard occupied) {
+    static constexpr std::int8_t steps[8] = {1, 0, -1, 0, 0, 1, 0, -1};
+    return rayAttacks(sq, occupied, steps);
 }
 
 inline void attacks::initSliders(Square sq, Magic table[], U64 magic,
-                                 const std::function<Bitboard(Square, Bitboard)> &attacks) {
+                                 Bitboard (*attacks)(Square, Bitboard)) {
     // The edges of the board are not considered for the attacks
     // i.e. for the sq h7 edges will be a1-h1, a1-a8, a8-h8, ignoring the edge of the current square
     const Bitboard edges = ((Bitboard(Rank::RANK_1) | Bitboard(Rank::RANK_8)) & ~Bitboard(sq.rank())) |
@@ -2345,7 +2397,8 @@ inline void attacks::initSliders(Square sq, Magic table[], U64 magic,
     } while (occ);
 }
 
-inline void attacks::initAttacks() {
+// Runs once at startup, so it is optimized for size
+__attribute__((cold)) inline void attacks::initAttacks() {
     BishopTable[0].attacks = BishopAttacks;
 
     for (int i = 0; i < 64; i++) {
@@ -2906,11 +2959,32 @@ namespace chess {
 class uci {
    public:
     /**
-     * @brief Converts an internal move to a UCI string
+     * @brief Prints an internal move as a UCI string followed by a newline
      * @param move
      * @return
      */
     static void moveToUci(const Move &move) noexcept(false) {
+        printMove(move);
+        print("\n", 1);
+    }
+
+    /**
+     * @brief Prints an internal move as a UCI string
+     * @param move
+     * @return
+     */
+    static void printMove(const Move &move) noexcept(false) {
+		char out[6];
+		print(out, writeMove(move, out));
+    }
+
+    /**
+     * @brief Writes an internal move as a UCI string, not 0-terminated
+     * @param move
+     * @param out room for 5 characters
+     * @return the length
+     */
+    static int writeMove(const Move &move, char *out) noexcept(false) {
         // Get the from and to squares
         Square from_sq = move.from();
         Square to_sq   = move.to();
@@ -2921,8 +2995,6 @@ class uci {
             to_sq = Square(to_sq > from_sq ? File::FILE_G : File::FILE_C, from_sq.rank());
         }
 
-		char out[6];
-		
 		out[0] = 'a' + from_sq.file();
 		out[1] = '1' + from_sq.rank();
 		out[2] = 'a' + to_sq.file();
@@ -2933,8 +3005,7 @@ class uci {
 			out[4] = "nbrq"[static_cast<int>(move.promotionType()) - static_cast<int>(PieceType::underlying::KNIGHT)];
 		}
 		
-		print(out, move.typeOf() == Move::PROMOTION ? 5 : 4);
-		print("\n", 1);
+		return move.typeOf() == Move::PROMOTION ? 5 : 4;
     }
 
     /**
@@ -26,6 +26,12 @@ SOFTWARE.
 #include <cstdint>
 #include <time.h>
 #include <immintrin.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <atomic>
+#include <new>
 
 using Value = int16_t;
 
@@ -43,6 +49,43 @@ using Value = int16_t;
 
 #define KILLERS 2
 
+//Principal variation search: moves after the first get a zero window first
+#ifndef PVS
+#define PVS 1
+#endif
+
+//Aspiration windows: from ASPIRATION_DEPTH plies on, each iteration searches a window of
+//ASPIRATION_WINDOW around the last value, doubling it on a fail high or low. Set
+//ASPIRATION_DEPTH to MAX_PLY to always search the full window.
+#ifndef ASPIRATION_DEPTH
+#define ASPIRATION_DEPTH 5
+#endif
+#ifndef ASPIRATION_WINDOW
+#define ASPIRATION_WINDOW 50
+#endif
+#define ASPIRATION_MAX_WINDOW 1600
+
+//Optional parts, left out of the Kaggle build (go.sh) so that it fits in 64KB. Define them
+//to build them in.
+//#define SMP  //Lazy SMP helper threads (a -t <threads>); Kaggle gives the engine one core
+//#define TT_RESIZE  //Transposition table size option (a -h <hash MB>), huge pages for large tables
+//#define OLD_MOVEGEN  //Unstaged move generation, switched by Engine::staged_movegen (bench movegen)
+//#define EVAL_CACHE  //Static eval cache next to the TT (a -e <KB>); hits too rarely to pay off
+//#define DIAGNOSTICS  //Extra M log lines: depth reached, stop reason, time lost to unfinished iterations, ponder hit rate, eval cache hit rate
+//#define NNUE_LOAD_BLOB  //NNUE weights from a blob written by bench weights_blob (a -w <file>)
+//#define UCI  //UCI front end, used instead of the Kaggle protocol when the first command is "uci"
+
+#define MAX_THREADS 64
+
+//Time control. Kaggle gives a 10s reserve and 0.1s a move, with 50-100ms of latency; the
+//first move spends more, since nothing was pondered. For UCI, the latency is the GUI's overhead.
+#define KAGGLE_RESERVE 10'000'000'000
+#define KAGGLE_INCREMENT 100'000'000
+#define KAGGLE_LATENCY 100'000'000
+#define KAGGLE_MOVES_TO_GO 50
+#define KAGGLE_FIRST_MOVES_TO_GO 20
+#define UCI_LATENCY 10'000'000
+
 /////////////////////////////////////////////////////////////////////////////
 //Includes (unity build)
 /////////////////////////////////////////////////////////////////////////////
@@ -62,34 +105,195 @@ using Value = int16_t;
 using namespace chess;
 
 #include "transposition_table.cpp"
+#include "time_manager.cpp"
 
 /////////////////////////////////////////////////////////////////////////////
 //Search, eval, and main
 /////////////////////////////////////////////////////////////////////////////
 
-Board board = Board("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
-alignas(64) Movelist move_stack[MAX_PLY];
-alignas(64) Move search_moves[MAX_PLY];
-alignas(64) Move killers[MAX_PLY][KILLERS];
-int32_t history_h[6][12][64];
-Value static_eval_stack[MAX_PLY];
-Move pv;
-uint64_t nodes;
-uint64_t qnodes;
-uint64_t max_depth;
-uint64_t time_allocated;
-timespec think_time_start;
-bool pondering;
-bool stop;
-Value last_value;
+struct Engine;
 
+//All state of one search thread. An Engine owns one of these per thread, and
+//nothing here is shared, so any number of engines can run in one process.
+struct SearchContext
+{
+	Engine& engine;
+#ifdef SMP
+	int thread_id;
+#else
+	static constexpr int thread_id = 0;
+#endif
+	std::atomic<bool>& stop;  //owned by the engine, shared with its other threads
+	
+	Board board = Board("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+	alignas(64) Movelist move_stack[MAX_PLY];
+	alignas(64) Move search_moves[MAX_PLY];
+	alignas(64) Move killers[MAX_PLY][KILLERS];
+	int32_t history_h[6][12][64];
+	Value static_eval_stack[MAX_PLY];
+	Move pv;
+	uint64_t pv_nodes;                  //nodes the root search spent on pv
+	uint64_t nodes;
+	uint64_t qnodes;
+	uint64_t max_depth;
+	uint64_t researches;                //PVS re-searches after a zero window failed high
+	uint64_t aspiration_fail_lows;      //root re-searches after the aspiration window failed low
+	uint64_t aspiration_fail_highs;     //root re-searches after the aspiration window failed high
+	uint64_t iteration_nodes[MAX_PLY];  //nodes spent on each iteration, by depth in plies
+#ifdef EVAL_CACHE
+	uint64_t eval_probes;               //static evals needed after a TT miss
+	uint64_t eval_hits;                 //of those, found in the eval cache instead of running the network
+#endif
+	
 #if DEBUGGING > 1
-uint64_t move_order[8][8];
+	uint64_t move_order[8][8];
+#endif
+
+	SearchContext(Engine& engine_, int thread_id_);
+	
+	Value calc_static_eval();
+	void clear_history();
+	int32_t& history_entry(Move m);
+	int16_t history_score(Move m);
+	void update_history(Movelist &ms, int n_moves, Move best_move, int depth);
+	void score_quiets(Movelist& ms, int first);
+#ifdef OLD_MOVEGEN
+	void order_all_moves(Movelist& ms, int ply);
 #endif
+	void print_pv(int depth);
+	bool check_kaggle_insufficient();
+	bool gives_check(Move m);
+	int see(Move m);
+	bool is_legal(Move m);
+	Value alpha_beta(int depth, int ply, Value lower_bound, Value upper_bound, int16_t skip_move);
+	Move search();
+};
 
-Value calc_static_eval()
+//One game being played: the time control, the stop flag, the transposition table and the
+//Lazy SMP threads. The input thread watches stdin and the clock and sets stop; the main
+//thread (thread_id 0) also checks the clock itself, so time is kept without the input thread.
+struct Engine
 {
-	return nnue::evaluate(nnue::accumulator[static_cast<int>(board.sideToMove())]);
+	SearchContext* threads[MAX_THREADS];
+#ifdef SMP
+	int n_threads = 0;
+	int n_allocated = 1;  //contexts and helper threads made so far, which n_threads can be below
+#else
+	static constexpr int n_threads = 1;
+#endif
+	TranspositionTable tt;
+#ifdef EVAL_CACHE
+	EvalCache eval_cache;
+#endif
+	TimeManager time_manager;
+	timespec think_time_start;
+	std::atomic<bool> pondering;  //read at the root by every thread; a ponder hit clears it
+	std::atomic<bool> stop;
+#ifdef DIAGNOSTICS
+	StopReason stop_reason;  //why the last search stopped
+#endif
+	Value last_value;
+	int depth_limit = 63;  //in plies
+#ifdef DIAGNOSTICS
+	int last_depth;                   //of the last iteration the main thread finished, in plies
+	uint64_t ponder_predictions = 0;  //ponder searches on a predicted reply
+	uint64_t ponder_hits = 0;         //and how many of them the opponent played
+#endif
+#ifdef UCI
+	bool uci = false;  //UCI front end: report each iteration, and stop on a command
+	uint64_t node_limit = UINT64_MAX;  //main thread nodes, checked every 4096
+	timespec search_start;  //when search() started, which node counts are from
+#else
+	static constexpr bool uci = false;
+	static constexpr uint64_t node_limit = UINT64_MAX;
+#endif
+#ifdef OLD_MOVEGEN
+	bool staged_movegen = true;
+#else
+	static constexpr bool staged_movegen = true;
+#endif
+	alignas(SearchContext) char main_context[sizeof(SearchContext)];  //threads[0], constructed by init()
+	
+	//Input thread (see input_main), under input_mutex
+	bool input_stops = false;              //whether input stops the current search
+	uint64_t input_deadline = UINT64_MAX;  //of the current search, in monotonic_ns()
+	int input_wake[2] = {-1, -1};          //pipe to the input thread: the deadline changed
+	bool predicting = false;               //pondering on a predicted move, which input may confirm
+	char prediction[8];                    //Kaggle: the move, as sent after the time character
+	int prediction_length;
+	bool hit_posted = false;               //a ponder hit, for the main search thread to apply
+	uint64_t hit_start;                    //monotonic_ns() when it arrived
+	TimeLimits hit_limits;                 //for the move
+#ifdef UCI
+	TimeLimits ponder_limits;              //for the move once ponderhit arrives
+	bool input_searching = false;          //search() is running, so isready is posted
+	bool ready_posted = false;             //isready, for the main search thread to answer
+#endif
+	std::atomic<bool> input_posted = false;  //something was posted; read by the search without the lock
+	
+#ifdef SMP
+	//Lazy SMP helper synchronization
+	pthread_t helper_threads[MAX_THREADS];
+	pthread_mutex_t smp_mutex = PTHREAD_MUTEX_INITIALIZER;
+	pthread_cond_t smp_cond = PTHREAD_COND_INITIALIZER;
+	uint32_t smp_generation = 0;  //incremented to start the helpers on a new search
+	uint32_t smp_game = 0;        //incremented on a new game so the helpers clear their history
+	int smp_running = 0;          //number of helpers still searching
+	Board smp_root;               //copy of the main thread's board, which changes during its search
+#endif
+	
+	void init(int threads_, uint64_t tt_clusters);
+#ifdef SMP
+	void set_threads(int threads_);
+#endif
+	uint64_t memory();
+	uint64_t time_elapsed();
+	void stop_search(StopReason reason);
+	bool take_ponder_hit(TimeLimits& limits);
+	void post_input();
+	void apply_input();
+	void set_predicting(bool on);
+	void new_game();
+	void start_helpers();
+	void stop_helpers();
+	uint64_t report_threads(const timespec& start);
+#ifdef EVAL_CACHE
+	void report_eval_cache();
+#endif
+#ifdef UCI
+	void report_iteration(int depth, Value v);
+#endif
+	
+	Board& board() { return threads[0]->board; }
+	Move search();
+	Move predicted_reply(Move best_move);
+};
+
+#ifdef SMP
+SearchContext::SearchContext(Engine& engine_, int thread_id_) : engine(engine_), thread_id(thread_id_), stop(engine_.stop)
+#else
+SearchContext::SearchContext(Engine& engine_, int) : engine(engine_), stop(engine_.stop)
+#endif
+{
+	clear_history();
+}
+
+Value SearchContext::calc_static_eval()
+{
+#ifdef EVAL_CACHE
+	eval_probes++;
+	Value v;
+	if(engine.eval_cache.probe(board.hash(), v))
+	{
+		eval_hits++;
+		return v;
+	}
+	v = nnue::evaluate(board.accumulator(), static_cast<int>(board.sideToMove()));
+	engine.eval_cache.store(board.hash(), v);
+	return v;
+#else
+	return nnue::evaluate(board.accumulator(), static_cast<int>(board.sideToMove()));
+#endif
 }
 
 Value piece_value(PieceType pt)
@@ -98,7 +302,7 @@ Value piece_value(PieceType pt)
 	return values[static_cast<int>(pt)];
 }
 
-void clear_history()
+void SearchContext::clear_history()
 {
 	for(int i = 0; i < 6; ++i)
 		for(int j = 0; j < 12; ++j)
@@ -106,7 +310,7 @@ void clear_history()
 				history_h[i][j][k] = 0;
 }
 
-int32_t& history_entry(Move m)
+int32_t& SearchContext::history_entry(Move m)
 {
 	int i = static_cast<int>(board.at<PieceType>(m.to()));
 	i -= i > 5;
@@ -117,12 +321,12 @@ int32_t& history_entry(Move m)
 	return history_h[i][j][k];
 }
 
-int16_t history_score(Move m)
+int16_t SearchContext::history_score(Move m)
 {
 	return history_entry(m) >> 5;
 }
 
-void update_history(Movelist &ms, int n_moves, Move best_move, int depth)
+void SearchContext::update_history(Movelist &ms, int n_moves, Move best_move, int depth)
 {
 	int bonus = std::clamp(depth * depth, 1, 1024);
 	int malus = -std::max(bonus / 8, 1);
@@ -136,12 +340,12 @@ void update_history(Movelist &ms, int n_moves, Move best_move, int depth)
 }
 
 #ifdef DEBUGGING
-void print_pv(int depth)
+void SearchContext::print_pv(int depth)
 {
 	if(depth <= 0)
 		return;
-	TTRef ttRef	= get_TTEntry(board.hash());
-	if(ttRef.found && ttRef.entry.move != Move::NO_MOVE)
+	TTRef ttRef	= engine.tt.get(board.hash());
+	if(ttRef.found && ttRef.entry.move != Move::NO_MOVE && is_legal(ttRef.entry.move))
 	{
 		printf("%s ", move_str(ttRef.entry.move));
 		board.makeMove(ttRef.entry.move);
@@ -151,39 +355,394 @@ void print_pv(int depth)
 }
 #endif
 
-bool input_ready()
+uint64_t Engine::time_elapsed()
 {
-    fd_set rd;
-    timeval tv = {0};
-    
-    FD_ZERO(&rd);
-    FD_SET(STDIN_FILENO, &rd);
-    return select(1, &rd, NULL, NULL, &tv) > 0;
+	timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return static_cast<uint64_t>(now.tv_sec - think_time_start.tv_sec) * 1000000000ull + now.tv_nsec - think_time_start.tv_nsec;
 }
 
-uint64_t time_elapsed()
+/////////////////////////////////////////////////////////////////////////////
+//Input thread: the only reader of stdin, blocking on it so that the search never polls.
+//Input goes into the buffer in utility.cpp and, if the search ends on input (pondering,
+//UCI), sets stop at once. It also sets stop at the search's deadline. It runs once per
+//message rather than per node, so its larger functions are cold (optimized for size).
+/////////////////////////////////////////////////////////////////////////////
+
+//stdin is the process's, so its buffer (in utility.cpp) and lock are too. What the input
+//thread does with it for a search is the engine's (Engine's input fields, under the lock).
+pthread_mutex_t input_mutex = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t input_cond = PTHREAD_COND_INITIALIZER;
+bool input_eof = false;
+
+uint64_t monotonic_ns()
 {
 	timespec now;
 	clock_gettime(CLOCK_MONOTONIC, &now);
-	return static_cast<uint64_t>(now.tv_sec - think_time_start.tv_sec) * 1000000000ull + now.tv_nsec - think_time_start.tv_nsec;
+	return static_cast<uint64_t>(now.tv_sec) * 1000000000ull + now.tv_nsec;
+}
+
+//Time for a move, from the wrapper's time character: the reserve left in seconds, plus 32
+//(rounded down, so one second is kept back)
+TimeLimits kaggle_time(char c)
+{
+	uint64_t reserve = static_cast<uint64_t>(std::max(c - 32, 0)) * 1'000'000'000;
+	return time_limits(reserve, KAGGLE_INCREMENT, KAGGLE_LATENCY, KAGGLE_MOVES_TO_GO);
+}
+
+//Stops the search, keeping the first reason given
+void Engine::stop_search([[maybe_unused]] StopReason reason)
+{
+#ifdef DIAGNOSTICS
+	if(!stop.exchange(true))
+		stop_reason = reason;
+#else
+	stop = true;
+#endif
 }
 
-void sort_moves(Movelist& moves)
+//Under input_mutex: takes the input confirming the predicted move if it is next (ponderhit in
+//UCI, the move in the Kaggle protocol), with the time limits for the move
+bool Engine::take_ponder_hit(TimeLimits& limits)
 {
+#ifdef UCI
+	if(uci)
+	{
+		limits = ponder_limits;
+		return take_command("ponderhit");
+	}
+#endif
+	char message[16];
+	if(input_size() != prediction_length + 1 || __builtin_memcmp(input_buf + input_start + 1, prediction, prediction_length) != 0)
+		return false;
+	take_input(message, sizeof(message));
+	limits = kaggle_time(message[0]);
+	return true;
+}
+
+//Under input_mutex, on new input or a new search: posts the input the search handles itself
+//(a ponder hit, and isready in UCI), and stops the search on any other input. A hit turns
+//the ponder search into the timed search for the move, so it goes on instead of restarting.
+__attribute__((cold)) void Engine::post_input()
+{
+	while(true)
+	{
+#ifdef UCI
+		if(uci && input_searching && take_command("isready"))
+		{
+			ready_posted = true;
+			input_posted = true;
+			continue;
+		}
+#endif
+		if(!predicting || !take_ponder_hit(hit_limits))
+			break;
+		predicting = false;
+		hit_posted = true;
+		input_posted = true;
+		hit_start = monotonic_ns();
+		input_stops = uci;
+		input_deadline = hit_limits.hard == UINT64_MAX ? UINT64_MAX : hit_start + hit_limits.hard;
+	}
+	
+	bool waiting = input_size() > 0 || input_eof;
+#ifdef UCI
+	if(uci)
+		waiting = has_line() || input_eof;  //only a whole command stops it
+#endif
+	if(input_stops && waiting)
+		stop_search(STOP_INPUT);
+}
+
+//On the main search thread, at its next node or when its search starts or ends: switches to
+//the move's time after a ponder hit, so nothing the search reads changes under it, and
+//answers isready, so that readyok never lands inside an info line. The new limits are
+//checked as at the end of an iteration, since the next one may not come in time.
+void Engine::apply_input()
+{
+	pthread_mutex_lock(&input_mutex);
+	if(hit_posted)
+	{
+		think_time_start = {static_cast<time_t>(hit_start / 1000000000), static_cast<long>(hit_start % 1000000000)};
+		time_manager.limits = hit_limits;
+		pondering = false;
+		hit_posted = false;
+		StopReason reason = time_manager.check(time_elapsed(), monotonic_ns());
+		if(reason != STOP_NONE)
+			stop_search(reason);
+	}
+#ifdef UCI
+	if(ready_posted)
+	{
+		print("readyok\n",8);
+		ready_posted = false;
+	}
+#endif
+	input_posted = false;
+	pthread_mutex_unlock(&input_mutex);
+}
+
+//Turns the ponder hit test on before a search on a predicted move, or off after it, applying
+//any hit it took. Pondering is off afterwards if there was one.
+void Engine::set_predicting(bool on)
+{
+	pthread_mutex_lock(&input_mutex);
+	predicting = on;
+	pthread_mutex_unlock(&input_mutex);
+	apply_input();
+}
+
+__attribute__((cold)) void* input_main(void* arg)
+{
+	Engine& engine = *static_cast<Engine*>(arg);
+	pollfd fds[2] = {{STDIN_FILENO, POLLIN, 0}, {engine.input_wake[0], POLLIN, 0}};
+	char buf[4096];
+	while(true)
+	{
+		pthread_mutex_lock(&input_mutex);
+		uint64_t deadline = engine.input_deadline;
+		pthread_mutex_unlock(&input_mutex);
+		
+		//in whole ms, rounded up so that the deadline has passed when it returns
+		uint64_t now = monotonic_ns();
+		poll(fds, 2, deadline == UINT64_MAX ? -1 : deadline > now ? (deadline - now + 999999) / 1000000 : 0);
+		
+		int bytes = 0;
+		if(fds[1].revents && read(engine.input_wake[0], buf, sizeof(buf)) <= 0)
+			fds[1].fd = -1;
+		if(fds[0].revents)
+		{
+			bytes = read(STDIN_FILENO, buf, sizeof(buf));
+			if(bytes <= 0)
+				fds[0].fd = -1;  //end of input: stop polling it
+		}
+		
+		pthread_mutex_lock(&input_mutex);
+		if(monotonic_ns() >= engine.input_deadline)
+		{
+			engine.stop_search(STOP_HARD);
+			engine.input_deadline = UINT64_MAX;
+		}
+		if(fds[0].revents)
+		{
+			if(bytes > 0)
+				push_input(buf, bytes);
+			else
+				input_eof = true;
+			engine.post_input();
+			pthread_cond_broadcast(&input_cond);
+		}
+		pthread_mutex_unlock(&input_mutex);
+	}
+	return nullptr;
+}
+
+//Without it (as in bench), searches still end on time, from the main thread's own clock checks
+void start_input_thread(Engine& engine)
+{
+	pthread_t thread;
+	if(pipe(engine.input_wake) != 0 || pthread_create(&thread, nullptr, input_main, &engine) != 0)
+	{
+		print_err("Input thread failed\n", 20);
+		exit(-1);
+	}
+}
+
+//Waits for input and takes up to size - 1 bytes of it, 0-terminated (Kaggle protocol, where
+//each message is one write). 0 at the end of input.
+int read_input(char* buf, int size)
+{
+	pthread_mutex_lock(&input_mutex);
+	while(input_size() == 0 && !input_eof)
+		pthread_cond_wait(&input_cond, &input_mutex);
+	int bytes = take_input(buf, size);
+	pthread_mutex_unlock(&input_mutex);
+	return bytes;
+}
+
+//Hands the input thread the search's deadline and whether input stops it, then searches.
+//Input that should stop the search may already be waiting, in which case it returns at once.
+Move Engine::search()
+{
+	apply_input();
+	uint64_t start = static_cast<uint64_t>(think_time_start.tv_sec) * 1000000000ull + think_time_start.tv_nsec;
+	pthread_mutex_lock(&input_mutex);
+	input_stops = pondering || uci;
+	uint64_t hard = time_manager.limits.hard;
+	input_deadline = hard == UINT64_MAX ? UINT64_MAX : start + hard;
+	stop = false;
+#ifdef DIAGNOSTICS
+	stop_reason = STOP_NONE;
+#endif
+#ifdef UCI
+	input_searching = true;
+#endif
+	post_input();
+	bool timed = input_deadline != UINT64_MAX;
+	pthread_mutex_unlock(&input_mutex);
+	if(input_wake[1] >= 0 && timed && write(input_wake[1], "", 1) != 1)
+		stop_search(STOP_HARD);
+	
+	Move best_move = threads[0]->search();
+#ifdef UCI
+	pthread_mutex_lock(&input_mutex);
+	input_searching = false;
+	pthread_mutex_unlock(&input_mutex);
+#endif
+	apply_input();
+	return best_move;
+}
+
+//The reply the TT expects to best_move, to ponder on (NO_MOVE if there is none)
+Move Engine::predicted_reply(Move best_move)
+{
+	Board& board = threads[0]->board;
+	board.makeMove(best_move);
+	TTRef ttRef = tt.get(board.hash());
+	Move reply = ttRef.found ? Move(ttRef.entry.move) : Move::NO_MOVE;
+	if(reply != Move::NO_MOVE && !threads[0]->is_legal(reply))
+		reply = Move::NO_MOVE;
+	board.unmakeMove(best_move);
+	return reply;
+}
+
+//Selection sort one step at a time: swaps the best scoring move in [idx, end) to idx. Most
+//nodes cut off after a move or two, so sorting the whole list would be wasted.
+void pick_move(Movelist& moves, int idx, int end)
+{
+	int best = idx;
+	for(int i = idx + 1; i < end; ++i)
+		if(moves[i].score() > moves[best].score())
+			best = i;
+	std::swap(moves[idx], moves[best]);
+}
+
+//Scores the quiet moves from ms[first] on: escapes from and moves into attacks by cheaper
+//pieces, checks and history
+void SearchContext::score_quiets(Movelist& ms, int first)
+{
+	//Find all squares attacked by < queen
+	Bitboard pieces = board.pieces(PieceType::PAWN, ~board.sideToMove());
+	Bitboard pawn_attacks = board.sideToMove() == Color::WHITE ? 
+		attacks::pawnLeftAttacks<Color::BLACK>(pieces) | attacks::pawnRightAttacks<Color::BLACK>(pieces)
+		: attacks::pawnLeftAttacks<Color::WHITE>(pieces) | attacks::pawnRightAttacks<Color::WHITE>(pieces);
+	
+	Bitboard minor_attacks = 0;
+	pieces = board.pieces(PieceType::KNIGHT, ~board.sideToMove());
+	while(pieces) 
+	{
+		const auto index = pieces.pop();
+		minor_attacks |= attacks::knight(index);
+	}
+	
+	pieces = board.pieces(PieceType::BISHOP, ~board.sideToMove());
+	while(pieces) 
+	{
+		const auto index = pieces.pop();
+		minor_attacks |= attacks::bishop(index, board.occ());
+	}
+	
+	Bitboard rook_attacks = 0;
+	pieces = board.pieces(PieceType::ROOK, ~board.sideToMove());
+	while(pieces)
+	{
+		const auto index = pieces.pop();
+		rook_attacks |= attacks::rook(index, board.occ());
+	}				
+	
+	for(int i = first; i < ms.size(); ++i)
+	{
+		if(ms[i].typeOf() == Move::PROMOTION)
+		{
+			ms[i].setScore(ms[i].promotionType() == PieceType::QUEEN ? 10000 : -10000);
+		}
+		else if(ms[i].typeOf() == Move::CASTLING)
+		{
+			ms[i].setScore(100);
+		}
+		else if(board.at(ms[i].to()) != Piece::NONE)
+		{
+			//losing capture, already scored
+		}
+		else
+		{
+			Value score = 0;
+			
+			//For quiet moves, add for escapes, subtract for putting into danger
+			Bitboard from = Bitboard::fromSquare(ms[i].from());
+			Bitboard to = Bitboard::fromSquare(ms[i].to());
+			Bitboard threats = pawn_attacks | minor_attacks;
+			
+			switch(board.at<PieceType>(ms[i].from()).internal())
+			{
+				case PieceType::KNIGHT:
+				case PieceType::BISHOP:
+					if(pawn_attacks & to)
+						score -= piece_value(PieceType::KNIGHT) / 2;
+					else if(pawn_attacks & from)
+						score += piece_value(PieceType::KNIGHT) / 2;
+					break;
+				case PieceType::ROOK:
+					if(threats & to)
+						score -= piece_value(PieceType::ROOK) / 2;
+					else if(threats & from)
+						score += piece_value(PieceType::ROOK) / 2;
+					break;
+				case PieceType::QUEEN:
+					threats |= rook_attacks;
+					if(threats & to)
+						score -= piece_value(PieceType::QUEEN) / 2;
+					else if(threats & from)
+						score += piece_value(PieceType::QUEEN) / 2;
+				default: 
+					break;
+			}						
+			
+			if(gives_check(ms[i]))
+			{
+				score += 150;
+			}
+			
+			score *= 16;
+			score += history_score(ms[i]);
+			ms[i].setScore(score);
+		}
+	}
+}
+
+#ifdef OLD_MOVEGEN
+//The ordering from before staged move generation, kept for comparison: every legal move is
+//scored, the killers boosted and the whole list insertion sorted before the first is tried
+void SearchContext::order_all_moves(Movelist& ms, int ply)
+{
+	score_quiets(ms, 0);
+	for(auto& m : ms)
+	{
+		Value captured_val = piece_value(board.at<PieceType>(m.to()));
+		if(m.typeOf() == Move::ENPASSANT)
+			m.setScore(piece_value(PieceType::PAWN) * 16 + history_score(m));
+		else if(m.typeOf() == Move::NORMAL && captured_val != 0)
+			m.setScore((captured_val + (gives_check(m) ? 150 : 0)) * 16 + history_score(m));
+		
+		if(ply > 0)
+			for(int i = 0; i < KILLERS; ++i)
+				if(killers[ply][i] == m)
+					m.setScore(std::max(m.score() + 0, 200 - i));
+	}
+	
 	//insertion sort as per Wikipedia
-	for(int i = 1; i < moves.size(); ++i)
+	for(int i = 1; i < ms.size(); ++i)
 	{
-		Move temp = moves[i];
+		Move temp = ms[i];
 		int j = i;
-		for(; j > 0 && moves[j-1].score() < temp.score(); --j)
-		{
-			moves[j] = moves[j-1];
-        }
-		moves[j] = temp;
-    }
+		for(; j > 0 && ms[j-1].score() < temp.score(); --j)
+			ms[j] = ms[j-1];
+		ms[j] = temp;
+	}
 }
+#endif
 
-bool check_kaggle_insufficient()
+bool SearchContext::check_kaggle_insufficient()
 {
 	/*
 	//Code from Kaggle environments which we want to replicate
@@ -243,7 +802,7 @@ Value mate_counter(Value x)
 	return x + (x < -31000) - (x > 31000);
 }
 
-bool gives_check(Move m)
+bool SearchContext::gives_check(Move m)
 {
 	//todo: discovered checks
 	Bitboard king = board.pieces(PieceType::KING, ~board.sideToMove());
@@ -264,15 +823,82 @@ bool gives_check(Move m)
 	}
 }
 
-Value alpha_beta(int depth, int ply, Value lower_bound, Value upper_bound, int16_t skip_move)
+//Static exchange evaluation: the material m wins once both sides have recaptured on its target
+//square with their least valuable attackers, each side stopping when that is better for it
+int SearchContext::see(Move m)
+{
+	static const int values[] = { 100, 290, 300, 500, 900, 20000, 0 };
+	Square to = m.to();
+	Bitboard occ = board.occ() ^ Bitboard::fromSquare(m.from());
+	int gain[32];
+	int n = 0;
+	
+	gain[0] = values[static_cast<int>(board.at<PieceType>(to))];
+	if(m.typeOf() == Move::ENPASSANT)
+	{
+		gain[0] = values[0];
+		occ ^= Bitboard::fromSquare(Square(to.file(), m.from().rank()));
+	}
+	
+	Bitboard bishops = board.pieces(PieceType::BISHOP) | board.pieces(PieceType::QUEEN);
+	Bitboard rooks = board.pieces(PieceType::ROOK) | board.pieces(PieceType::QUEEN);
+	//Sliders are added in the loop below, as the pieces in front of them capture
+	Bitboard attackers = (attacks::pawn(Color::BLACK, to) & board.pieces(PieceType::PAWN, Color::WHITE))
+		| (attacks::pawn(Color::WHITE, to) & board.pieces(PieceType::PAWN, Color::BLACK))
+		| (attacks::knight(to) & board.pieces(PieceType::KNIGHT)) | (attacks::king(to) & board.pieces(PieceType::KING));
+	
+	int piece = static_cast<int>(board.at<PieceType>(m.from()));
+	Color side = ~board.sideToMove();
+	while(true)
+	{
+		//Sliders behind the pieces that have captured join in
+		attackers |= (attacks::bishop(to, occ) & bishops) | (attacks::rook(to, occ) & rooks);
+		attackers &= occ;
+		Bitboard ours = attackers & board.us(side);
+		if(!ours)
+			break;
+		
+		int pt = 0;
+		while(!(ours & board.pieces(static_cast<PieceType::underlying>(pt))))
+			pt++;
+		
+		n++;
+		gain[n] = values[piece] - gain[n - 1];
+		piece = pt;
+		occ ^= Bitboard::fromSquare((ours & board.pieces(static_cast<PieceType::underlying>(pt))).lsb());
+		side = ~side;
+	}
+	
+	for(; n > 0; --n)
+		gain[n - 1] = -std::max(-gain[n - 1], gain[n]);
+	return gain[0];
+}
+
+//A TT move can come from a different position (hash collision), so check it before playing it
+bool SearchContext::is_legal(Move m)
+{
+	Piece piece = board.at(m.from());
+	if(piece == Piece::NONE || piece.color() != board.sideToMove())
+		return false;
+	
+	Movelist ms;
+	movegen::legalmoves(ms, board, movegen::MoveGenType::ALL, 1 << static_cast<int>(piece.type()));
+	for(auto x : ms)
+		if(x == m)
+			return true;
+	return false;
+}
+
+Value SearchContext::alpha_beta(int depth, int ply, Value lower_bound, Value upper_bound, int16_t skip_move)
 {
-	//update search stats
-	++nodes;
+	//update search stats. Other threads read nodes for the UCI info lines, so it is stored
+	//atomically, but only this thread writes it, so it needs no locked add.
+	__atomic_store_n(&nodes, nodes + 1, __ATOMIC_RELAXED);
 	max_depth = std::max(max_depth, static_cast<uint64_t>(ply));
 
 	//fetch TT
-	TTRef ttRef = get_TTEntry(board.hash());
-	//make a copy because it's possible it gets overwritten in the recursion
+	TTRef ttRef = engine.tt.get(board.hash());
+	//ttRef.entry is already a copy, safe from being overwritten in the recursion or by other threads
 	TTEntry ttEntry = ttRef.entry;
 
 	//check for draws
@@ -312,12 +938,15 @@ Value alpha_beta(int depth, int ply, Value lower_bound, Value upper_bound, int16
 			}
 		}
 		
-		if((nodes & 4095) == 0)
+		if(thread_id == 0 && (nodes & 4095) == 0)
 		{
-			//check for time or end of pondering
-			if(time_elapsed() > time_allocated || (pondering && input_ready()))
+			//Input is the input thread's job, and it sets stop at the deadline too, but the clock
+			//is checked here as well (no syscall) so that time is kept without it
+			if(engine.input_posted.load(std::memory_order_relaxed))
+				engine.apply_input();
+			if(engine.time_elapsed() > engine.time_manager.limits.hard || nodes >= engine.node_limit)
 			{
-				stop = true;
+				engine.stop_search(nodes >= engine.node_limit ? STOP_NODES : STOP_HARD);
 				return 0;
 			}
 		}
@@ -332,7 +961,7 @@ Value alpha_beta(int depth, int ply, Value lower_bound, Value upper_bound, int16
 	if(ttRef.found && ttEntry.depth >= depth && skip_move == Move::NO_MOVE)
 	{
 		Value search_eval = ttEntry.search_eval;
-		if(search_eval != TT_NO_VALUE && (ply > 0 || ttEntry.move != Move::NO_MOVE) && (ply > 0 || !pondering))
+		if(search_eval != TT_NO_VALUE && (ply > 0 || (ttEntry.move != Move::NO_MOVE && is_legal(ttEntry.move))) && (ply > 0 || !engine.pondering))
 		{
 			if(
 				(ttEntry.gen_and_bound & TTBound::EXACT) == TTBound::EXACT
@@ -359,9 +988,11 @@ Value alpha_beta(int depth, int ply, Value lower_bound, Value upper_bound, int16
 	
 	auto in_check = board.inCheck();
 	
-	auto ms = move_stack[ply];
+	auto& ms = move_stack[ply];
 	ms.clear();
 	int move_gen = 0;
+	int stage = 0;      //main search: 0 = captures, 1 = killers, 2 = other quiets
+	int stage_end = 0;  //moves before stage_end have been generated and scored
 	
 	//Initialze killer moves
 	if(ply+1 < MAX_PLY)
@@ -385,7 +1016,7 @@ Value alpha_beta(int depth, int ply, Value lower_bound, Value upper_bound, int16
 		{
 			if(!ttRef.found)
 			{
-				ttRef.entry.write(board.hash(), Move::NO_MOVE, static_eval, best_value, 0, TTBound::LOWER);
+				ttRef.write(board.hash(), Move::NO_MOVE, static_eval, best_value, 0, TTBound::LOWER);
 			}
 			
 			return best_value;
@@ -432,7 +1063,7 @@ Value alpha_beta(int depth, int ply, Value lower_bound, Value upper_bound, int16
 					return -32000;
 				
 				//Prioritize captures
-				for(auto move : ms)
+				for(auto& move : ms)
 				{
 					Value captured_val = piece_value(board.at<PieceType>(move.to()));
 					move.setScore(captured_val);
@@ -447,6 +1078,15 @@ Value alpha_beta(int depth, int ply, Value lower_bound, Value upper_bound, int16
 				{
 					Value captured_val = piece_value(board.at<PieceType>(ms[i].to()));
 					Value my_val = piece_value(board.at<PieceType>(ms[i].from()));
+					
+					//Skip captures that lose material
+					if(my_val > captured_val && see(ms[i]) < 0)
+					{
+						ms[i] = Move::NO_MOVE;
+						ms[i].setScore(-32000);
+						continue;
+					}
+					
 					ms[i].setScore(captured_val - my_val / 16 + history_score(ms[i]));
 				}
 				
@@ -466,125 +1106,85 @@ Value alpha_beta(int depth, int ply, Value lower_bound, Value upper_bound, int16
 					}
 				}
 			}
-			else if(move_gen == 3) //Regular move generation: all moves ordered by various heuristics
+#ifdef OLD_MOVEGEN
+			else if(move_gen == 3 && !engine.staged_movegen)
 			{
 				movegen::legalmoves(ms, board);
-		
 				if(ms.size() == 0)
-				{
-					//checkmate or stalemate
-					if(in_check)
-						return -32000;
-					else
-						return 0;
-				}
-				
-				//Find all squares attacked by < queen
-				Bitboard pieces = board.pieces(PieceType::PAWN, ~board.sideToMove());
-				Bitboard pawn_attacks = board.sideToMove() == Color::WHITE ? 
-					attacks::pawnLeftAttacks<Color::BLACK>(pieces) | attacks::pawnRightAttacks<Color::BLACK>(pieces)
-					: attacks::pawnLeftAttacks<Color::WHITE>(pieces) | attacks::pawnRightAttacks<Color::WHITE>(pieces);
-				
-				Bitboard minor_attacks = 0;
-				pieces = board.pieces(PieceType::KNIGHT, ~board.sideToMove());
-				while(pieces) 
-				{
-					const auto index = pieces.pop();
-					minor_attacks |= attacks::knight(index);
-				}
-				
-				pieces = board.pieces(PieceType::BISHOP, ~board.sideToMove());
-				while(pieces) 
-				{
-					const auto index = pieces.pop();
-					minor_attacks |= attacks::bishop(index, board.occ());
-				}
-				
-				Bitboard rook_attacks = 0;
-				pieces = board.pieces(PieceType::ROOK, ~board.sideToMove());
-				while(pieces)
-				{
-					const auto index = pieces.pop();
-					rook_attacks |= attacks::rook(index, board.occ());
-				}				
+					return in_check ? -32000 : 0;
+				order_all_moves(ms, ply);
+				stage = 2;
+				stage_end = ms.size();
+			}
+#endif
+			else if(move_gen == 3) //Main search: captures first, quiets only once the captures run out
+			{
+				movegen::legalmoves(ms, board, movegen::MoveGenType::CAPTURE);
 				
+				//MVV/LVA. Captures that lose material by SEE are moved behind the others and
+				//left for after the quiets.
+				stage_end = 0;
 				for(int i = 0; i < ms.size(); ++i)
 				{
-					if(ms[i].typeOf() == Move::PROMOTION)
-					{
-						ms[i].setScore(ms[i].promotionType() == PieceType::QUEEN ? 10000 : -10000);
-					}
-					else if(ms[i].typeOf() == Move::CASTLING)
-					{
-						ms[i].setScore(100);
-					}
-					else if(ms[i].typeOf() == Move::ENPASSANT)
-					{
-						ms[i].setScore(piece_value(PieceType::PAWN) * 16 + history_score(ms[i]));
-					}
+					Move& m = ms[i];
+					if(m.typeOf() == Move::PROMOTION)
+						m.setScore(m.promotionType() == PieceType::QUEEN ? 10000 : -10000);
 					else
 					{
-						Value score = piece_value(board.at<PieceType>(ms[i].to()));
-						
-						if(score == 0)
-						{
-							//For quiet moves, add for escapes, subtract for putting into danger
-							Bitboard from = Bitboard::fromSquare(ms[i].from());
-							Bitboard to = Bitboard::fromSquare(ms[i].to());
-							Bitboard threats = pawn_attacks | minor_attacks;
-							
-							switch(board.at<PieceType>(ms[i].from()).internal())
-							{
-								case PieceType::KNIGHT:
-								case PieceType::BISHOP:
-									if(pawn_attacks & to)
-										score -= piece_value(PieceType::KNIGHT) / 2;
-									else if(pawn_attacks & from)
-										score += piece_value(PieceType::KNIGHT) / 2;
-									break;
-								case PieceType::ROOK:
-									if(threats & to)
-										score -= piece_value(PieceType::ROOK) / 2;
-									else if(threats & from)
-										score += piece_value(PieceType::ROOK) / 2;
-									break;
-								case PieceType::QUEEN:
-									threats |= rook_attacks;
-									if(threats & to)
-										score -= piece_value(PieceType::QUEEN) / 2;
-									else if(threats & from)
-										score += piece_value(PieceType::QUEEN) / 2;
-								default: 
-									break;
-							}						
-						}
-						
-						if(gives_check(ms[i]))
+						Value captured_val = m.typeOf() == Move::ENPASSANT ? piece_value(PieceType::PAWN) : piece_value(board.at<PieceType>(m.to()));
+						Value my_val = piece_value(board.at<PieceType>(m.from()));
+						int exchange = my_val > captured_val ? see(m) : 0;
+						if(exchange < 0)
 						{
-							score += 150;
+							m.setScore(-16000 + exchange);
+							continue;
 						}
-						
-						score *= 16;
-						score += history_score(ms[i]);
-						ms[i].setScore(score);
+						m.setScore(captured_val * 16 - my_val + history_score(m));
 					}
+					std::swap(ms[i], ms[stage_end++]);
 				}
 			}
 			
-			//boost killer moves
-			if(ply > 0)
-				for(auto & m : ms)
-					if(m != Move::NO_MOVE)
-						for(int i = 0; i < KILLERS; ++i)
-							if(killers[ply][i] == m)
-								m.setScore(std::max(m.score()+0, 200 - i));
-						
-			sort_moves(ms);
+			if(move_gen != 3)
+				stage_end = ms.size();
+		}
+		
+		//Main search: after the captures, generate the quiets and try the killers before scoring the rest
+		while(move_gen == 3 && move_idx == stage_end && stage < 2)
+		{
+			if(stage == 0)
+			{
+				movegen::legalmoves(ms, board, movegen::MoveGenType::QUIET);
+				if(ms.size() == 0)
+				{
+					//checkmate or stalemate
+					if(in_check)
+						return -32000;
+					else
+						return 0;
+				}
+				
+				if(ply > 0)
+					for(int i = 0; i < KILLERS; ++i)
+						for(int j = stage_end; j < ms.size(); ++j)
+							if(ms[j] == killers[ply][i])
+							{
+								ms[j].setScore(200 - i);
+								std::swap(ms[j], ms[stage_end++]);
+								break;
+							}
+			}
+			else
+			{
+				score_quiets(ms, stage_end);
+				stage_end = ms.size();
 #if DEBUGGING > 1
-			if(ply == 0)
-				for(auto & m : ms)
-					printf("%s %d\n", move_str(m), m.score());
+				if(ply == 0)
+					for(auto & m : ms)
+						printf("%s %d\n", move_str(m), m.score());
 #endif
+			}
+			stage++;
 		}
 		
 		//Are we done?
@@ -594,17 +1194,19 @@ Value alpha_beta(int depth, int ply, Value lower_bound, Value upper_bound, int16
 		//Get next move from list
 		if(move_idx >= 0)
 		{
+			pick_move(ms, move_idx, stage_end);
 			move = ms[move_idx];
 			if(ttRef.found && move == ttEntry.move)
 				continue;
 		}
 		else
-			move = ttRef.found ? ttEntry.move : Move::NO_MOVE;
+			move = ttRef.found && ttEntry.move != Move::NO_MOVE && is_legal(ttEntry.move) ? ttEntry.move : Move::NO_MOVE;
 				
 		if(move == Move::NO_MOVE || move == skip_move)
 			continue;
 		
 		moves_tried++;
+		uint64_t move_start = nodes;
 		
 		//Make sure we always have a move in case we get interrupted before we normally write the move
 		if(ply == 0 && pv == Move::NO_MOVE)
@@ -686,7 +1288,21 @@ Value alpha_beta(int depth, int ply, Value lower_bound, Value upper_bound, int16
 		//Evaluate
 		board.makeMove(move);
 		search_moves[ply] = move;
-		Value x = mate_counter(-alpha_beta(depth - depth_reduction, ply + 1, -upper_bound, -lower_bound, Move::NO_MOVE));
+		Value x;
+#if PVS
+		//Only prove the move can't beat lower_bound, and re-search with the full window if it does
+		if(moves_tried > 0 && upper_bound > lower_bound + 1)
+		{
+			x = mate_counter(-alpha_beta(depth - depth_reduction, ply + 1, -lower_bound - 1, -lower_bound, Move::NO_MOVE));
+			if(x > lower_bound && x <= upper_bound && !stop)
+			{
+				researches++;
+				x = mate_counter(-alpha_beta(depth - depth_reduction, ply + 1, -upper_bound, -lower_bound, Move::NO_MOVE));
+			}
+		}
+		else
+#endif
+			x = mate_counter(-alpha_beta(depth - depth_reduction, ply + 1, -upper_bound, -lower_bound, Move::NO_MOVE));
 		board.unmakeMove(move);
 		
 		//Interrupted?
@@ -707,6 +1323,7 @@ Value alpha_beta(int depth, int ply, Value lower_bound, Value upper_bound, int16
 			if(ply == 0)
 			{
 				pv = move;
+				pv_nodes = nodes - move_start;
 #ifdef DEBUGGING
 				printf("New PV %d %s ", x, move_str(pv));
 				board.makeMove(move);
@@ -721,7 +1338,7 @@ Value alpha_beta(int depth, int ply, Value lower_bound, Value upper_bound, int16
 		if(x > upper_bound)
 		{
 			if(skip_move == Move::NO_MOVE)
-				ttRef.entry.write(board.hash(), best_move.move(), static_eval, best_value, depth, TTBound::LOWER);
+				ttRef.write(board.hash(), best_move.move(), static_eval, best_value, depth, TTBound::LOWER);
 			
 #if DEBUGGING > 1			
 			if(best_move_num != -1)
@@ -750,8 +1367,13 @@ Value alpha_beta(int depth, int ply, Value lower_bound, Value upper_bound, int16
 	//Write TT unless we were interrupted
 	if(!stop)
 	{
+		//After a fail low at the root every move is only an upper bound, so keep the last PV
+		//move first for the aspiration re-search
+		if(ply == 0 && best_value < lower_bound && ttRef.found && ttEntry.move != Move::NO_MOVE)
+			best_move = ttEntry.move;
+		
 		if(skip_move == Move::NO_MOVE)
-			ttRef.entry.write(board.hash(), best_move.move(), static_eval, best_value, depth, best_value >= lower_bound ? TTBound::EXACT : TTBound::UPPER);
+			ttRef.write(board.hash(), best_move.move(), static_eval, best_value, depth, best_value >= lower_bound ? TTBound::EXACT : TTBound::UPPER);
 		if(best_value >= lower_bound)
 			update_history(ms, ms.size(), best_move, depth);
 	}
@@ -764,142 +1386,765 @@ Value alpha_beta(int depth, int ply, Value lower_bound, Value upper_bound, int16
 	return best_value;
 }
 
-Move search()
+/////////////////////////////////////////////////////////////////////////////
+//Lazy SMP: helper threads search the same root with their own state, sharing only the TT
+/////////////////////////////////////////////////////////////////////////////
+
+#ifdef SMP
+void* helper_main(void* arg)
+{
+	SearchContext& context = *static_cast<SearchContext*>(arg);
+	Engine& engine = context.engine;
+	uint32_t generation = 0;
+	uint32_t game = 0;
+	while(true)
+	{
+		pthread_mutex_lock(&engine.smp_mutex);
+		while(engine.smp_generation == generation)
+			pthread_cond_wait(&engine.smp_cond, &engine.smp_mutex);
+		generation = engine.smp_generation;
+		
+		//Left over after the number of threads went down
+		if(context.thread_id >= engine.n_threads)
+		{
+			pthread_mutex_unlock(&engine.smp_mutex);
+			continue;
+		}
+		
+		context.board = engine.smp_root;
+		if(game != engine.smp_game)
+		{
+			game = engine.smp_game;
+			context.clear_history();
+		}
+		pthread_mutex_unlock(&engine.smp_mutex);
+		
+		context.search();
+		
+		pthread_mutex_lock(&engine.smp_mutex);
+		if(--engine.smp_running == 0)
+			pthread_cond_broadcast(&engine.smp_cond);
+		pthread_mutex_unlock(&engine.smp_mutex);
+	}
+	return nullptr;
+}
+#endif
+
+//Sets up the table and the threads, which are the only allocations an engine makes (the
+//main thread's context is inside the engine)
+void Engine::init(int threads_, uint64_t tt_clusters)
+{
+	tt.init(tt_clusters);
+	tt.clear();
+	threads[0] = new (main_context) SearchContext(*this, 0);
+#ifdef SMP
+	set_threads(threads_);
+#endif
+}
+
+#ifdef SMP
+//Makes helper contexts and threads up to threads_ in all. Called again between searches to
+//change the number of threads (UCI's Threads option); helpers above it stay idle.
+void Engine::set_threads(int threads_)
 {
-	nodes = 0;
+	pthread_mutex_lock(&smp_mutex);
+	for(int i = n_allocated; i < threads_; ++i)
+		threads[i] = new SearchContext(*this, i);
+	n_threads = threads_;
+	pthread_mutex_unlock(&smp_mutex);
+	
+	for(int i = n_allocated; i < threads_; ++i)
+		pthread_create(&helper_threads[i], nullptr, helper_main, threads[i]);
+	n_allocated = std::max(n_allocated, threads_);
+}
+#endif
+
+//Bytes used by this engine: itself, which includes the main thread's context, its
+//transposition table, its eval cache and its helpers
+uint64_t Engine::memory()
+{
+	uint64_t bytes = sizeof(Engine) + tt.bytes + (n_threads - 1) * sizeof(SearchContext);
+#ifdef EVAL_CACHE
+	bytes += eval_cache.bytes;
+#endif
+	return bytes;
+}
+
+void Engine::new_game()
+{
+	tt.clear();
+	threads[0]->clear_history();
+#ifdef SMP
+	pthread_mutex_lock(&smp_mutex);
+	smp_game++;
+	pthread_mutex_unlock(&smp_mutex);
+#endif
+}
+
+#ifdef SMP
+void Engine::start_helpers()
+{
+	if(n_threads == 1)
+		return;
+	pthread_mutex_lock(&smp_mutex);
+	smp_root = board();
+	smp_running = n_threads - 1;
+	for(int i = 1; i < n_threads; ++i)
+		__atomic_store_n(&threads[i]->nodes, 0, __ATOMIC_RELAXED);  //so node counts read before a helper wakes up are not stale
+	smp_generation++;
+	pthread_cond_broadcast(&smp_cond);
+	pthread_mutex_unlock(&smp_mutex);
+}
+
+void Engine::stop_helpers()
+{
+	if(n_threads == 1)
+		return;
+	stop = true;
+	pthread_mutex_lock(&smp_mutex);
+	while(smp_running > 0)
+		pthread_cond_wait(&smp_cond, &smp_mutex);
+	pthread_mutex_unlock(&smp_mutex);
+}
+#else
+void Engine::start_helpers() {}
+void Engine::stop_helpers() {}
+#endif
+
+//Total nodes over all threads, and with helpers per-thread nodes/NPS since start as M log lines
+uint64_t Engine::report_threads(const timespec& start)
+{
+	uint64_t total = 0;
+	for(int i = 0; i < n_threads; ++i)
+	{
+		total += threads[i]->nodes;
+		if(n_threads > 1)
+		{
+			timespec now;
+			clock_gettime(CLOCK_MONOTONIC, &now);
+			uint64_t ms = (static_cast<uint64_t>(now.tv_sec - start.tv_sec) * 1000000000ull + now.tv_nsec - start.tv_nsec) / 1000000;
+			print("Mthread",7);
+			print_num(i);
+			print(" nodes=",7);
+			print_num(threads[i]->nodes);
+			print(" nps=",5);
+			print_num(threads[i]->nodes * 1000 / (ms + 1));
+			print("\n",1);
+		}
+	}
+	return total;
+}
+
+#ifdef EVAL_CACHE
+//Eval cache hits over all threads as an M log line: each hit is a forward pass saved
+void Engine::report_eval_cache()
+{
+	uint64_t probes = 0, hits = 0;
+	for(int i = 0; i < n_threads; ++i)
+	{
+		probes += threads[i]->eval_probes;
+		hits += threads[i]->eval_hits;
+	}
+	print("Meval_cache hits=",17);
+	print_num(hits);
+	print(" probes=",8);
+	print_num(probes);
+	print(" rate=",6);
+	print_num(hits * 100 / (probes + 1));
+	print("%\n",2);
+}
+#endif
+
+#ifdef UCI
+//UCI info line for an iteration the main thread finished. The pv follows the TT from the root move.
+void Engine::report_iteration(int depth, Value v)
+{
+	SearchContext& context = *threads[0];
+	uint64_t total = 0;
+	for(int i = 0; i < n_threads; ++i)
+		total += __atomic_load_n(&threads[i]->nodes, __ATOMIC_RELAXED);
+	timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	uint64_t search_ns = static_cast<uint64_t>(now.tv_sec - search_start.tv_sec) * 1000000000ull + now.tv_nsec - search_start.tv_nsec;
+	
+	print("info depth ",11);
+	print_num(depth);
+	if(std::abs(v) > 31000)
+	{
+		print(v < 0 ? " score mate -" : " score mate ", v < 0 ? 13 : 12);
+		print_num((32001 - std::abs(v)) / 2);
+	}
+	else
+	{
+		print(v < 0 ? " score cp -" : " score cp ", v < 0 ? 11 : 10);
+		print_num(std::abs(v));
+	}
+	print(" nodes ",7);
+	print_num(total);
+	print(" nps ",5);
+	print_num(total * 1000000000 / (search_ns + 1));
+	print(" hashfull ",10);
+	print_num(tt.hashfull());
+	print(" time ",6);
+	print_num(time_elapsed() / 1000000);
+	print(" pv",3);
+	
+	Board& board = context.board;
+	Move moves[MAX_PLY];
+	int n = 0;
+	for(Move m = context.pv; n < depth && m != Move::NO_MOVE && context.is_legal(m);)
+	{
+		print(" ",1);
+		uci::printMove(m);
+		board.makeMove(m);
+		moves[n++] = m;
+		TTRef ttRef = tt.get(board.hash());
+		m = ttRef.found ? Move(ttRef.entry.move) : Move::NO_MOVE;
+	}
+	while(n > 0)
+		board.unmakeMove(moves[--n]);
+	print("\n",1);
+}
+#endif
+
+/////////////////////////////////////////////////////////////////////////////
+
+//Iterative deepening. On the main thread this also drives the helpers; helpers
+//run it until the main thread sets stop, and odd helpers start one ply deeper.
+Move SearchContext::search()
+{
+	__atomic_store_n(&nodes, 0, __ATOMIC_RELAXED);
 	
 	//debugging stats
 	qnodes = 0;
+	researches = 0;
+	aspiration_fail_lows = 0;
+	aspiration_fail_highs = 0;
+	for(int i = 0; i < MAX_PLY; ++i)
+		iteration_nodes[i] = 0;
+#ifdef EVAL_CACHE
+	eval_probes = 0;
+	eval_hits = 0;
+#endif
 	
 #if DEBUGGING > 1	
-	for(int i = 0; i < 8; ++i)
-		for(int j = 0; j < 8; j++)
-			move_order[i][j] = 0;
+	if(thread_id == 0)
+		for(int i = 0; i < 8; ++i)
+			for(int j = 0; j < 8; j++)
+				move_order[i][j] = 0;
 #endif		
 	
-	stop = false;
+	if(thread_id == 0)
+	{
+		engine.tt.advance_gen();
+#ifdef DIAGNOSTICS
+		engine.last_depth = 0;
+#endif
+		engine.start_helpers();
+	}
+#ifdef TT_RESIZE
+	prefetch_table = engine.tt.prefetching ? &engine.tt : nullptr;
+#endif
 	Move best_move = Move::NO_MOVE;
-	advance_TT_gen();
 	Value min_value = -32001;
 	Value max_value = 32001;
-	//Value bound_inc = 100;
-	for(int depth = 4; depth < 256 && !stop;)
+	int window = ASPIRATION_WINDOW;
+	for(int depth = 4 + 4 * (thread_id & 1); depth <= 4 * engine.depth_limit && !stop;)
 	{
 		max_depth = 0;
 		pv = Move::NO_MOVE;
+		pv_nodes = 0;
 #ifdef DEBUGGING
-		printf("Search d = %d a = %d b = %d\n", depth, min_value, max_value);
+		if(thread_id == 0)
+			printf("Search d = %d a = %d b = %d\n", depth, min_value, max_value);
 #endif		
+		uint64_t iteration_start = nodes;
 		Value v = alpha_beta(depth, 0, min_value, max_value, Move::NO_MOVE);
-		if(v != -32001)
+		iteration_nodes[depth / 4] += nodes - iteration_start;
+		if(v != -32001 && thread_id == 0)
 		{
-			last_value = v;
+			engine.last_value = v;
 		}
 #ifdef DEBUGGING
-		printf("Depth = %d %s. Eval = %d, nodes = %lu/q%lu, max_plies = %lu, bestmove = %s\n", depth, stop ? "stop" : "finished",
-			last_value, nodes, qnodes, max_depth, move_str(pv));
-#if DEBUGGING > 1			
-		for(int j = 0; j < 8; ++j)
+		if(thread_id == 0)
 		{
-			printf("depth %d*4: ", j);
-			for(int i = 0; i < 8; ++i)
-				printf("%d: %ld  ", i, move_order[j][i]);
-			printf("\n");
-		}
+			printf("Depth = %d %s. Eval = %d, nodes = %lu/q%lu, max_plies = %lu, bestmove = %s\n", depth, stop ? "stop" : "finished",
+				engine.last_value, nodes, qnodes, max_depth, move_str(pv));
+#if DEBUGGING > 1			
+			for(int j = 0; j < 8; ++j)
+			{
+				printf("depth %d*4: ", j);
+				for(int i = 0; i < 8; ++i)
+					printf("%d: %ld  ", i, move_order[j][i]);
+				printf("\n");
+			}
 #endif		
+		}
 #endif
 
-		if(v >= min_value && v <= max_value)
+		//A fail high's move beat the window, so it is better than the last best move. After
+		//a fail low every move scored below it, so keep the last best move.
+		if(v >= min_value)
 			best_move = pv;
 
 		if(v != 32001 && !stop)
 		{
-			if(v >= min_value && v <= max_value)
+			if(v < min_value)
+			{
+				aspiration_fail_lows++;
+				min_value = window > ASPIRATION_MAX_WINDOW ? -32001 : std::max(-32001, v - window);
+				window *= 2;
+			}
+			else if(v > max_value)
 			{
+				aspiration_fail_highs++;
+				max_value = window > ASPIRATION_MAX_WINDOW ? 32001 : std::min(32001, v + window);
+				window *= 2;
+			}
+			else
+			{
+#ifdef DIAGNOSTICS
+				if(thread_id == 0)
+					engine.last_depth = depth / 4;
+#endif
+#ifdef UCI
+				if(thread_id == 0 && engine.uci)
+					engine.report_iteration(depth / 4, v);
+#endif
+				if(thread_id == 0)
+				{
+					TimeManager& tm = engine.time_manager;
+					uint64_t now = monotonic_ns();
+					tm.iteration_done(depth / 4, pv, v, pv_nodes, iteration_nodes[depth / 4], now);
+					StopReason reason = tm.check(engine.time_elapsed(), now);
+					if(reason != STOP_NONE && !engine.pondering)
+						engine.stop_search(reason);
+				}
 				depth += 4;
 				
-				//Commented out code here is for aspiration window -- unclear benefit
-				//bound_inc = 100 + std::abs(v) / 4;
-				//min_value = std::max(-32000, v - bound_inc);
-				//max_value = std::min(32000, v + bound_inc);
+				//Mate scores get the full window since they jump by far more than any window
+				window = ASPIRATION_WINDOW;
+				if(depth >= 4 * ASPIRATION_DEPTH && std::abs(v) < 31000)
+				{
+					min_value = v - window;
+					max_value = v + window;
+				}
+				else
+				{
+					min_value = -32001;
+					max_value = 32001;
+				}
 			}
-			// else if(v < min_value)
-			// {
-				// min_value = std::max(-32000, v - bound_inc);
-				// bound_inc = std::min(bound_inc * 2, 3200);
-			// }
-			// else
-			// {
-				// max_value = std::min(32000, v + bound_inc);
-				// bound_inc = std::min(bound_inc * 2, 3200);
-			// }
 		}
 	}
 	
+	if(thread_id == 0)
+	{
+#ifdef DIAGNOSTICS
+		if(!stop)
+			engine.stop_reason = STOP_DEPTH;
+#endif
+		engine.stop_helpers();
+	}
+	
 	if(best_move != Move::NO_MOVE)
 		return best_move;
 	else
 		return pv;
 }
 
-int main(void)
+#ifndef NO_MAIN
+
+Engine engine;
+
+//Gets the NNUE weights ready on a thread of its own, overlapping the rest of startup,
+//so that none of it lands on the first move's clock. It runs once, so it is optimized for size.
+__attribute__((cold)) void* init_nnue(void* weights_file)
 {
+#ifdef NNUE_LOAD_BLOB
+	if(weights_file)
+	{
+		nnue::load_weights_file(static_cast<const char*>(weights_file));
+		return nullptr;
+	}
+#endif
+	nnue::init_default();
+	return nullptr;
+}
+
+#ifdef UCI
+/////////////////////////////////////////////////////////////////////////////
+//UCI front end, used instead of the Kaggle protocol when the first command is "uci".
+//Everything about a game comes with each command, so one process can play any number
+//of games for a match runner.
+/////////////////////////////////////////////////////////////////////////////
+
+bool starts_with(const char* str, const char* prefix)
+{
+	while(*prefix && *str == *prefix)
+		++str, ++prefix;
+	return *prefix == 0;
+}
+
+//Waits for the first bytes of input, and leaves them to be read
+bool input_starts_with(const char* prefix)
+{
+	char buf[16];
+	pthread_mutex_lock(&input_mutex);
+	while(input_size() < static_cast<int>(__builtin_strlen(prefix)) && !input_eof)
+		pthread_cond_wait(&input_cond, &input_mutex);
+	int i = 0;
+	for(; i < input_size() && i < static_cast<int>(sizeof(buf)) - 1; ++i)
+		buf[i] = input_buf[input_start + i];
+	buf[i] = 0;
+	pthread_mutex_unlock(&input_mutex);
+	return starts_with(buf, prefix);
+}
+
+//Waits for a whole line of input. nullptr at the end of input. The line stays valid until
+//the next call.
+char* read_line()
+{
+	static char* line = nullptr;
+	static int capacity = 0;
+	pthread_mutex_lock(&input_mutex);
+	bool found;
+	while(!(found = take_line(line, capacity)) && !(input_eof && input_size() == 0))
+	{
+		if(input_eof)
+			push_input("\n", 1);  //last line without a newline
+		else
+			pthread_cond_wait(&input_cond, &input_mutex);
+	}
+	pthread_mutex_unlock(&input_mutex);
+	return found ? line : nullptr;
+}
+
+//The word token in line, or nullptr
+char* find_token(char* line, const char* token)
+{
+	for(char* p = line; *p; ++p)
+		if((p == line || p[-1] == ' ') && starts_with(p, token))
+		{
+			char end = p[__builtin_strlen(token)];
+			if(end == ' ' || end == 0)
+				return p;
+		}
+	return nullptr;
+}
+
+//The word after token in line, or nullptr
+char* token_arg(char* line, const char* token)
+{
+	char* p = find_token(line, token);
+	if(!p)
+		return nullptr;
+	p += __builtin_strlen(token);
+	while(*p == ' ')
+		++p;
+	return p;
+}
+
+uint64_t token_num(char* line, const char* token)
+{
+	char* p = token_arg(line, token);
+	return p ? parse_num(p) : 0;
+}
+
+void uci_position(Engine& engine, char* line)
+{
+	Board& board = engine.board();
+	char* moves = find_token(line, "moves");
+	if(moves)
+		moves[-1] = 0;
+	
+	char* fen = token_arg(line, "fen");
+	if(fen)
+	{
+		for(char* end = fen + __builtin_strlen(fen); end > fen && end[-1] == ' ';)
+			*--end = 0;
+		board = Board(fen);
+	}
+	else
+		board = Board();
+	
+	if(moves)
+		for(char* p = moves + 5; *p;)
+		{
+			while(*p == ' ')
+				++p;
+			if(*p == 0)
+				break;
+			board.makeMove(uci::uciToMove(board, p));
+			board.compact();
+			while(*p && *p != ' ')
+				++p;
+		}
+}
+
+//Time for this move: movetime as given, otherwise from the clock, the increment and
+//movestogo (the time manager's latency is the GUI's overhead)
+TimeLimits uci_time(Engine& engine, char* line)
+{
+	if(find_token(line, "movetime"))
+		return fixed_time(token_num(line, "movetime") * 1000000);
+	
+	bool white = engine.board().sideToMove() == Color::WHITE;
+	if(!find_token(line, white ? "wtime" : "btime"))
+		return fixed_time(UINT64_MAX);
+	uint64_t left = token_num(line, white ? "wtime" : "btime");
+	uint64_t inc = token_num(line, white ? "winc" : "binc");
+	uint64_t moves_to_go = find_token(line, "movestogo") ? token_num(line, "movestogo") + 1 : 31;
+	return time_limits(left * 1000000, inc * 1000000, UCI_LATENCY, moves_to_go);
+}
+
+//Searches until the limits in the go command, or stop. isready is answered during the search,
+//and ponderhit lets it go on with the move's time. Other commands end it and are left for
+//uci_loop().
+void uci_go(Engine& engine, char* line)
+{
+	clock_gettime(CLOCK_MONOTONIC, &engine.think_time_start);
+	clock_gettime(CLOCK_MONOTONIC, &engine.search_start);
+	engine.ponder_limits = uci_time(engine, line);
+	engine.depth_limit = find_token(line, "depth") ? std::clamp<int>(token_num(line, "depth"), 1, MAX_PLY - 1) : 63;
+	engine.node_limit = find_token(line, "nodes") ? token_num(line, "nodes") : UINT64_MAX;
+	engine.pondering = find_token(line, "infinite") || find_token(line, "ponder");
+	engine.time_manager.limits = engine.pondering ? fixed_time(UINT64_MAX) : engine.ponder_limits;
+	engine.time_manager.new_search();
+	engine.set_predicting(find_token(line, "ponder"));
+	Move best_move = engine.search();
+	
+	//An infinite or ponder search that ran out of depth still waits for stop or ponderhit
+	pthread_mutex_lock(&input_mutex);
+	while(true)
+	{
+		if(take_command("isready"))
+			print("readyok\n",8);
+		else if(!engine.pondering || engine.hit_posted || has_line() || input_eof)
+			break;
+		else
+			pthread_cond_wait(&input_cond, &input_mutex);
+	}
+	pthread_mutex_unlock(&input_mutex);
+	engine.set_predicting(false);
+	
+	print("bestmove ",9);
+	if(best_move == Move::NO_MOVE)
+		print("0000",4);
+	else
+	{
+		uci::printMove(best_move);
+		Move reply = engine.predicted_reply(best_move);
+		if(reply != Move::NO_MOVE)
+		{
+			print(" ponder ",8);
+			uci::printMove(reply);
+		}
+	}
+	print("\n",1);
+}
+
+void uci_setoption(Engine& engine, char* line)
+{
+	char* name = token_arg(line, "name");
+	uint64_t value = token_num(line, "value");
+	if(!name)
+		return;
+	if(starts_with(name, "Hash"))
+	{
+		engine.tt.init(std::max<uint64_t>(value, 1) * 1024 * 1024 / sizeof(TTCluster));
+		engine.tt.clear();
+	}
+#ifdef SMP
+	if(starts_with(name, "Threads"))
+		engine.set_threads(std::clamp<int>(value, 1, MAX_THREADS));
+#endif
+}
+
+void uci_loop(Engine& engine)
+{
+	engine.uci = true;
+	while(char* line = read_line())
+	{
+		if(starts_with(line, "ucinewgame"))
+			engine.new_game();
+		else if(starts_with(line, "uci"))
+		{
+			print("id name kaggle_chess " VERSION "\nid author lukegustafson\n",49);
+			print("option name Hash type spin default ",35);
+			print_num(TT_CLUSTERS * sizeof(TTCluster) / (1024 * 1024));
+			print(" min 1 max 65536\n",17);
+#ifdef SMP
+			print("option name Threads type spin default 1 min 1 max 64\n",53);
+#endif
+			print("uciok\n",6);
+		}
+		else if(starts_with(line, "isready"))
+			print("readyok\n",8);
+		else if(starts_with(line, "setoption"))
+			uci_setoption(engine, line);
+		else if(starts_with(line, "position"))
+			uci_position(engine, line);
+		else if(starts_with(line, "go"))
+			uci_go(engine, line);
+		else if(starts_with(line, "quit"))
+			break;
+		//stop and ponderhit without a search are ignored
+	}
+}
+#endif
+
+//Options: -t <threads> (SMP builds), -h <hash MB> (TT_RESIZE builds), -e <eval cache KB> (EVAL_CACHE builds),
+//-w <NNUE weights blob> (NNUE_LOAD_BLOB builds)
+//main only runs setup and the protocol loop, so it is optimized for size
+__attribute__((cold)) int main(int argc, char** argv)
+{
+	timespec start;
+	clock_gettime(CLOCK_MONOTONIC, &start);
 	char buf[128];
+	int n_threads = 1;
+	uint64_t tt_clusters = TT_CLUSTERS;
+#ifdef EVAL_CACHE
+	uint64_t eval_entries = EVAL_CACHE_ENTRIES;
+#endif
+	const char* weights_file = nullptr;
 	
+	for(int i = 1; i + 1 < argc; i += 2)
+	{
+#ifdef SMP
+		if(argv[i][0] == '-' && argv[i][1] == 't')
+			n_threads = std::clamp(parse_num(argv[i+1]), 1, MAX_THREADS);
+#endif
+#ifdef TT_RESIZE
+		if(argv[i][0] == '-' && argv[i][1] == 'h')
+			tt_clusters = static_cast<uint64_t>(parse_num(argv[i+1])) * 1024 * 1024 / sizeof(TTCluster);
+#endif
+#ifdef EVAL_CACHE
+		if(argv[i][0] == '-' && argv[i][1] == 'e')
+			eval_entries = static_cast<uint64_t>(parse_num(argv[i+1])) * 1024 / sizeof(uint64_t);
+#endif
+#ifdef NNUE_LOAD_BLOB
+		if(argv[i][0] == '-' && argv[i][1] == 'w')
+			weights_file = argv[i+1];
+#endif
+	}
+	
+	pthread_t nnue_thread;
+	pthread_create(&nnue_thread, nullptr, init_nnue, const_cast<char*>(weights_file));
 	Zobrist::init();
-	clear_TT();
-	clear_history();
+	engine.init(n_threads, tt_clusters);
+#ifdef EVAL_CACHE
+	engine.eval_cache.init(eval_entries);
+#endif
+	Board& board = engine.board();
+	TimeLimits& limits = engine.time_manager.limits;
 
 	print("M" VERSION "\n",5);
 	print("MTT",3);
-	print_num(TT_CLUSTERS);
+	print_num(engine.tt.n_clusters);
+#ifdef TT_RESIZE
+	print("\nMTT_page=",10);
+	print_num(engine.tt.page_size());
+#endif
+#ifdef SMP
+	print("\nMthreads=",10);
+	print_num(n_threads);
+#endif
+#ifdef EVAL_CACHE
+	print("\nMeval_cache=",13);
+	print_num(engine.eval_cache.n_entries);
+#endif
+	print("\nMmemory=",9);
+	print_num(engine.memory());
+	
+	//Startup time in microseconds; the wrapper waits for this line before the first move
+	pthread_join(nnue_thread, nullptr);
+	timespec ready;
+	clock_gettime(CLOCK_MONOTONIC, &ready);
+	print("\nMready us=",11);
+	print_num((static_cast<uint64_t>(ready.tv_sec - start.tv_sec) * 1000000000ull + ready.tv_nsec - start.tv_nsec) / 1000);
 	print("\n",1);
-	while(true)
+	start_input_thread(engine);
+#ifdef UCI
+	if(input_starts_with("uci"))
 	{
-		if(read(0, buf, 128) > 0)
+		uci_loop(engine);
+		return 0;
+	}
+#endif
+	
+	while(read_input(buf, sizeof(buf)) > 0)
+	{
+		clock_gettime(CLOCK_MONOTONIC, &engine.think_time_start);
+					
+		if(buf[0] == 'q')
+			break;
+		if(buf[0] == 'f')
+		{
+			board = Board(buf+1);
+			limits = time_limits(KAGGLE_RESERVE, KAGGLE_INCREMENT, KAGGLE_LATENCY, KAGGLE_FIRST_MOVES_TO_GO);
+			engine.new_game();
+		}
+		else
+		{
+			Move move = uci::uciToMove(board, buf+1);
+			board.makeMove(move);
+			limits = kaggle_time(buf[0]);
+		}
+		
+		engine.pondering = false;
+		engine.time_manager.new_search();
+		Move best_move = engine.search();
+		
+		//Play the move and ponder on the reply the TT expects. When the opponent plays it, the
+		//ponder search goes on as the search for the next move, so play that one and go round again.
+		while(true)
 		{
-			clock_gettime(CLOCK_MONOTONIC, &think_time_start);
-						
-			if(buf[0] == 'q')
-				break;
-			if(buf[0] == 'f')
-			{
-				board = Board(buf+1);
-				time_allocated = 500'000'000;
-				clear_TT();
-				clear_history();
-			}
-			else
-			{
-				Move move = uci::uciToMove(board, buf+1);
-				board.makeMove(move);
-				time_allocated = 20'000'000 * static_cast<uint64_t>(buf[0] - 32);
-			}
-			
-			pondering = false;
-			nodes = 0;
-			Move best_move = search();
-						
 			timespec end_think;
 			clock_gettime(CLOCK_MONOTONIC, &end_think);
-			uint64_t x = static_cast<uint64_t>(end_think.tv_sec - think_time_start.tv_sec) * 1000000000ull + end_think.tv_nsec - think_time_start.tv_nsec;
+			uint64_t x = static_cast<uint64_t>(end_think.tv_sec - engine.think_time_start.tv_sec) * 1000000000ull + end_think.tv_nsec - engine.think_time_start.tv_nsec;
+#ifdef DIAGNOSTICS
+			engine.time_manager.move_done(x, monotonic_ns());
+#endif
 			x /= 1000000;
+			uint64_t total_nodes = engine.report_threads(engine.think_time_start);
 			print("Mtime=",6);
 			print_num(x);
 			print("\nMnodes=",8);
-			print_num(nodes);
+			print_num(total_nodes);
 			print("\nMvalue=",8);
-			if(last_value < 0)
+			if(engine.last_value < 0)
 			{
 				print("-",1);
-				print_num(-last_value);
+				print_num(-engine.last_value);
 			}
 			else
-				print_num(last_value);
+				print_num(engine.last_value);
+			print("\n",1);
+#ifdef DIAGNOSTICS
+			print("Mdepth=",7);
+			print_num(engine.last_depth);
+			print("\nMstop=",7);
+			print(STOP_REASONS[engine.stop_reason], __builtin_strlen(STOP_REASONS[engine.stop_reason]));
+			print(" base=",6);
+			print_num(limits.base / 1000000);
+			print(" soft=",6);
+			print_num(limits.soft / 1000000);
+			print(" hard=",6);
+			print_num(limits.hard / 1000000);
+			print("\nMwasted=",9);
+			print_num(engine.time_manager.wasted / 1000000);
+			print("/",1);
+			print_num(engine.time_manager.used / 1000000);
 			print("\n",1);
+#endif
+#if defined(EVAL_CACHE) && defined(DIAGNOSTICS)
+			engine.report_eval_cache();
+#endif
 			
 			uci::moveToUci(best_move);
-						
+			
+			Move reply = engine.predicted_reply(best_move);
 			board.makeMove(best_move);
 			board.compact();
 
@@ -913,28 +2158,64 @@ int main(void)
 				print(display, 9);
 			}
 
-			clock_gettime(CLOCK_MONOTONIC, &think_time_start);
-			time_allocated = 100'000'000;
+			clock_gettime(CLOCK_MONOTONIC, &engine.think_time_start);
+			limits = fixed_time(100'000'000);
 #else
-			time_allocated = 10'000'000'000;
+			limits = fixed_time(10'000'000'000);
+#endif
+			if(reply != Move::NO_MOVE)
+			{
+				board.makeMove(reply);
+				engine.prediction_length = uci::writeMove(reply, engine.prediction);
+#ifdef DIAGNOSTICS
+				engine.ponder_predictions++;
 #endif
-			pondering = true;
-			nodes = 0;
-			best_move = search();
+			}
+			engine.pondering = true;
+			engine.time_manager.new_search();
+			engine.set_predicting(reply != Move::NO_MOVE);
+			timespec ponder_start;
+			if(engine.n_threads > 1)
+				clock_gettime(CLOCK_MONOTONIC, &ponder_start);
+			best_move = engine.search();
+			engine.set_predicting(false);
+			bool hit = !engine.pondering;
+			uint64_t ponder_nodes = engine.report_threads(ponder_start);
 			print("Mponder_nodes=",14);
-			print_num(nodes);
+			print_num(ponder_nodes);
 			print("\n",1);
+#ifdef DIAGNOSTICS
+			engine.ponder_hits += hit;
+			print("Mponder_hits=",13);
+			print_num(engine.ponder_hits);
+			print("/",1);
+			print_num(engine.ponder_predictions);
+			print("\n",1);
+#endif
+#if defined(EVAL_CACHE) && defined(DIAGNOSTICS)
+			engine.report_eval_cache();
+#endif
 			
 #ifdef DEBUGGING
 			clock_gettime(CLOCK_MONOTONIC, &end_think);
-			x = static_cast<uint64_t>(end_think.tv_sec - think_time_start.tv_sec) * 1000000000ull + end_think.tv_nsec - think_time_start.tv_nsec;
+			x = static_cast<uint64_t>(end_think.tv_sec - engine.think_time_start.tv_sec) * 1000000000ull + end_think.tv_nsec - engine.think_time_start.tv_nsec;
 			x /= 1000000;
 			print_num(x);
 			print("\n",1);
 #endif
+			
+			//A miss: back to the position the opponent's move is played in
+			if(!hit)
+			{
+				if(reply != Move::NO_MOVE)
+					board.unmakeMove(reply);
+				break;
+			}
 		}
 	}
 	
 	return 0;
 
 }
+
+#endif
@@ -1,6 +1,9 @@
 from subprocess import*
 import time
 a=Popen("/kaggle_simulations/agent/a",stdin=PIPE,stdout=PIPE,text=True,bufsize=1)
+for l in a.stdout:
+    print(l)
+    if l[:6]=="Mready":break
 f=True
 def c(o):
     try:
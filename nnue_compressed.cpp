@@ -6,74 +6,201 @@
 #define NNUE_FILE "64_16_8_q64.cpp"
 #endif
 
+//The weights can also come from a blob instead of being decoded (a -w <file>, and bench).
+//go.sh leaves NNUE_LOAD_BLOB off, so it isn't in the Kaggle build.
+#if defined(NNUE_BLOB) && !defined(NNUE_LOAD_BLOB)
+#define NNUE_LOAD_BLOB 1
+#endif
+
+#ifdef NNUE_BLOB
+//Weights already decoded and laid out (a file written by bench weights_blob), built into the
+//binary with -DNNUE_BLOB=\"file\" in place of the compressed data
+asm(".section .rodata\n.balign 32\nnnue_blob:\n.incbin \"" NNUE_BLOB "\"\nnnue_blob_end:\n.previous");
+extern "C" const uint8_t nnue_blob[], nnue_blob_end[];
+#endif
 
 namespace nnue {
 #include NNUE_FILE
 
-//Arithmetic decoder for one bit at a time
-//p = probability * 256, should be 1..256
-bool decode(uint32_t p)
+//Arithmetic decoder for the compressed weights. Each bit splits the range h at h * p / 256,
+//rounded down, and that rounding is part of the format, so bits are decoded one at a time
+//rather than several per table lookup. The split is branchless, since the sign and mantissa
+//bits are coin flips. A split leaves h >= 64 (h >= 16384 before it, and a bit with p = 256
+//is always 0), so one byte always renormalizes; the first two bytes are read up front.
+struct Decoder
 {
-	static uint32_t h = 1, c = 0, i = 0;
-	while(h < 16384)
-	{
-		h *= 256;
-		c *= 256;
-		c += compressed_data[i++];
-	}
-	uint32_t t = h * p >> 8;
-	if(c < t)
+	uint32_t h, c;
+	const uint8_t* data;
+	
+	Decoder() : h(65536), c(compressed_data[0] << 8 | compressed_data[1]), data(compressed_data + 2) {}
+	
+	//p = probability * 256, should be 1..256
+	bool decode(uint32_t p)
 	{
-		h = t;
-		return false;
+		if(h < 16384)
+		{
+			h <<= 8;
+			c = c << 8 | *data++;
+		}
+		uint32_t t = h * p >> 8;
+		uint32_t bit = c >= t;
+		uint32_t mask = -bit;  //masks rather than ?: so that gcc does not branch
+		c -= t & mask;
+		h = t + ((h - 2 * t) & mask);
+		return bit;
 	}
-	else
+	
+	//The next weight as stored: an integer multiple of 1/QUANTIZE (1/L1_QUANTIZE for layer 1 of
+	//a clipped ReLU network)
+	int32_t next_int()
 	{
-		c -= t;
-		h -= t;
-		return true;
+		int exp = 0;
+		while(decode(thresholds[exp]))
+			exp += 1;
+		
+		if(exp == 0)
+			return 0;
+		
+		int sign = decode(128) ? -1 : 1;
+		int x = 1 << (exp - 1);
+		for(int i = 0; i < exp - 1; ++i)
+			x |= decode(128) << i;
+		
+		return sign * x;
 	}
+};
+
+Decoder decoder;  //reset by decode_weights()
+
+//Not inlined: decode_weights() has a dozen call sites, and each copy costs submission bytes
+__attribute__((noinline)) int32_t next_int()
+{
+	return decoder.next_int();
 }
 
-int16_t next_weight()
+void reject_weights(const char* message, int length)
 {
-	int exp = 0;
-	while(decode(thresholds[exp]))
-		exp += 1;
-	
-	if(exp == 0)
-		return 0;
-	
-	int x = 0;
-	int sign = decode(128) ? -1 : 1;
-	for(int i = 0; i < exp - 1; ++i)
-		x += decode(128) << i;
-	x += 1 << exp - 1;
-	
-	return (sign * x << FIXED_POINT) / QUANTIZE;
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-result"
+	write(2, message, length);
+#pragma GCC diagnostic pop
+	exit(-1);
 }
 
-alignas(32) int32_t accumulator[2][INPUT_LAYER];
+//Weights are shared by every search. The accumulator belongs to a Board.
 alignas(32) int16_t PST[768 * INPUT_LAYER];
-alignas(32) int32_t l1_bias[INPUT_LAYER];
-alignas(32) int32_t l1_output[INPUT_LAYER];
-alignas(32) int32_t l2_weights[4][INPUT_LAYER * HIDDEN1];
+alignas(32) int16_t l1_bias[INPUT_LAYER];
+
+#ifdef NNUE_CRELU
+//Experimental clipped ReLU network (NNUE_FILE defines NNUE_CRELU and L1_QUANTIZE, as
+//64_16_8_q64_crelu.cpp does; the default net doesn't). Every activation is
+//clamped to 0..1, stored as 0..L1_QUANTIZE in a uint8, and hidden weights are int8 multiples
+//of 1/QUANTIZE, so layers 2 and 3 are vpmaddubsw dot products. The weights are decoded as
+//stored, already at these scales.
+#define L3_INPUTS 32  //HIDDEN1 padded to one register of uint8 inputs
+static_assert(QUANTIZE == 64, "layer outputs are rescaled with a shift by 6");
+static_assert(L1_QUANTIZE <= 127, "vpmaddubsw sums two activation * weight products in an int16");
+
+int32_t next_weight()
+{
+	return next_int();
+}
+
+int8_t next_int8()
+{
+	int32_t w = next_int();
+	if(w < INT8_MIN || w > INT8_MAX)
+		reject_weights("NNUE hidden weight does not fit int8\n", 37);
+	return w;
+}
+
+alignas(32) int8_t l2_weights[4][HIDDEN1 * INPUT_LAYER];  //[bucket][output * INPUT_LAYER + input]
 alignas(32) int32_t l2_bias[4][HIDDEN1];
-alignas(32) int32_t l2_output[HIDDEN1];
-alignas(32) int32_t l3_weights[4][HIDDEN1 * HIDDEN2];
+alignas(32) int8_t l3_weights[4][HIDDEN2 * L3_INPUTS];  //[bucket][output * L3_INPUTS + input], zero padded
 alignas(32) int32_t l3_bias[4][HIDDEN2];
-alignas(32) int32_t l3_output[HIDDEN2];
 alignas(32) int32_t l4_weights[4][HIDDEN2];
 int32_t l4_bias[4];
-int32_t game_phase;
-int32_t queens;
+#else
+int16_t next_weight()
+{
+	return (next_int() << FIXED_POINT) / QUANTIZE;
+}
+
+alignas(32) int16_t l2_weights[4][INPUT_LAYER * HIDDEN1];  //[bucket][input * HIDDEN1 + output], transposed at init()
+alignas(32) int32_t l2_bias[4][HIDDEN1];
+alignas(32) int32_t l3_weights[4][HIDDEN1 * HIDDEN2];  //[bucket][input * HIDDEN2 + output]
+alignas(32) int32_t l3_bias[4][HIDDEN2];
+alignas(32) int32_t l4_weights[4][HIDDEN2];
+int32_t l4_bias[4];
+uint64_t active_indices[256];  //positions of the set bits of each byte, packed into bytes
+#endif
+
+//int16 is enough for every position: see check_accumulator_range()
+struct Accumulator
+{
+	alignas(32) int16_t values[2][INPUT_LAYER];  //[perspective][neuron]
+	int32_t game_phase;
+	int32_t queens;
+};
+
+//Features changed by one move: at most two pieces removed and two placed (castling)
+struct AccumulatorDelta
+{
+	int n_removed;
+	int n_added;
+	int removed[2][2];  //{piece, square}
+	int added[2][2];
+};
 
 #ifdef DEBUGGING
 bool verbose = false;
 #endif
 
-void init()
+#ifdef NNUE_STATS
+//Number of evaluations by how many layer 1 outputs were nonzero (not thread safe; bench.cpp)
+uint64_t l1_active_histogram[INPUT_LAYER + 1];
+#endif
+
+//Each side has one king and at most 15 other pieces, so a neuron's accumulator lies within
+//the bias plus, per color, the king's extreme entry and 15 times the extreme entry of any
+//other piece. Partial sums may wrap, which int16 arithmetic undoes, so only this final
+//range has to fit. The shipped weights give -16280..15076.
+void check_accumulator_range()
+{
+	for(int j = 0; j < INPUT_LAYER; ++j)
+	{
+		int32_t low = l1_bias[j], high = l1_bias[j];
+		for(int color = 0; color < 2; ++color)
+		{
+			int32_t king_low = INT32_MAX, king_high = INT32_MIN, other_low = 0, other_high = 0;
+			for(int piece = 0; piece < 6; ++piece)
+				for(int square = 0; square < 64; ++square)
+				{
+					int32_t w = PST[((color*6 + piece)*64 + square) * INPUT_LAYER + j];
+					if(piece == 5)
+					{
+						king_low = std::min(king_low, w);
+						king_high = std::max(king_high, w);
+					}
+					else
+					{
+						other_low = std::min(other_low, w);
+						other_high = std::max(other_high, w);
+					}
+				}
+			low += king_low + 15 * other_low;
+			high += king_high + 15 * other_high;
+		}
+		
+		if(low < INT16_MIN || high > INT16_MAX)
+			reject_weights("NNUE accumulator can overflow int16\n", 36);
+	}
+}
+
+void decode_weights()
 {
+	decoder = Decoder();
+	
 	for(int piece = 0; piece < 6; ++piece)
 		for(int color = 0; color < 2; ++color)
 			for(int square = 0; square < 64; ++square)
@@ -90,14 +217,37 @@ void init()
 	
 	for(int h = 0; h < 4; ++h)
 	{
-		for(int i = 0; i < INPUT_LAYER * HIDDEN1; ++i)
-			l2_weights[h][i] = next_weight();
+#ifdef NNUE_CRELU
+		//Biases are stored as multiples of 1/QUANTIZE and added to sums of L1_QUANTIZE / QUANTIZE units
+		for(int i = 0; i < HIDDEN1 * INPUT_LAYER; ++i)
+			l2_weights[h][i] = next_int8();
+		
+		for(int i = 0; i < HIDDEN1; ++i)
+			l2_bias[h][i] = next_weight() * L1_QUANTIZE;
+		
+		for(int j = 0; j < HIDDEN2; ++j)
+			for(int i = 0; i < HIDDEN1; ++i)
+				l3_weights[h][j * L3_INPUTS + i] = next_int8();
+		
+		for(int i = 0; i < HIDDEN2; ++i)
+			l3_bias[h][i] = next_weight() * L1_QUANTIZE;
+		
+		for(int i = 0; i < HIDDEN2; ++i)
+			l4_weights[h][i] = next_weight();
+		
+		l4_bias[h] = next_weight() * L1_QUANTIZE;
+#else
+		//The compressed data is output-major; evaluate() wants each input's weights together
+		for(int j = 0; j < HIDDEN1; ++j)
+			for(int i = 0; i < INPUT_LAYER; ++i)
+				l2_weights[h][i * HIDDEN1 + j] = next_weight();
 		
 		for(int i = 0; i < HIDDEN1; ++i)
 			l2_bias[h][i] = next_weight();
 		
-		for(int i = 0; i < HIDDEN1 * HIDDEN2; ++i)
-			l3_weights[h][i] = next_weight();
+		for(int j = 0; j < HIDDEN2; ++j)
+			for(int i = 0; i < HIDDEN1; ++i)
+				l3_weights[h][i * HIDDEN2 + j] = next_weight();
 		
 		for(int i = 0; i < HIDDEN2; ++i)
 			l3_bias[h][i] = next_weight();
@@ -106,8 +256,112 @@ void init()
 			l4_weights[h][i] = next_weight();
 		
 		l4_bias[h] = next_weight();
+#endif
+	}
+}
+
+#ifdef NNUE_LOAD_BLOB
+//The weight arrays in the order a weights blob stores them, after a WeightsHeader. A blob is
+//only meant for the build that wrote it, so it is their memory image without any conversion.
+struct WeightsHeader
+{
+	uint32_t magic;
+	uint32_t shape;  //INPUT_LAYER, HIDDEN1, HIDDEN2 and the clipped ReLU scale (0 = ReLU), a byte each
+	uint32_t bytes;  //of the arrays that follow
+	uint32_t padding;
+};
+
+const struct { void* data; uint32_t size; } weight_arrays[] = {
+	{PST, sizeof(PST)}, {l1_bias, sizeof(l1_bias)},
+	{l2_weights, sizeof(l2_weights)}, {l2_bias, sizeof(l2_bias)},
+	{l3_weights, sizeof(l3_weights)}, {l3_bias, sizeof(l3_bias)},
+	{l4_weights, sizeof(l4_weights)}, {l4_bias, sizeof(l4_bias)},
+};
+
+WeightsHeader weights_header()
+{
+	uint32_t bytes = 0;
+	for(auto& a : weight_arrays)
+		bytes += a.size;
+#ifdef NNUE_CRELU
+	uint32_t scale = L1_QUANTIZE;
+#else
+	uint32_t scale = 0;
+#endif
+	return WeightsHeader{0x45554e4e, INPUT_LAYER | HIDDEN1 << 8 | HIDDEN2 << 16 | scale << 24, bytes, 0};
+}
+
+//Copies the weights out of a blob: no decoding, just one memcpy per array
+void load_weights(const uint8_t* blob, uint64_t size)
+{
+	WeightsHeader expected = weights_header(), header;
+	if(size < sizeof(header))
+		reject_weights("NNUE weights blob does not match this build\n", 44);
+	__builtin_memcpy(&header, blob, sizeof(header));
+	if(header.magic != expected.magic || header.shape != expected.shape || header.bytes != expected.bytes || size != sizeof(header) + header.bytes)
+		reject_weights("NNUE weights blob does not match this build\n", 44);
+	
+	blob += sizeof(header);
+	for(auto& a : weight_arrays)
+	{
+		__builtin_memcpy(a.data, blob, a.size);
+		blob += a.size;
 	}
 }
+#endif
+
+//Gets the weights from a blob if there is one, otherwise from the compressed data, and
+//derives the tables that depend on them. Call once per process, before any Board is evaluated;
+//engines then only read them, so any number of engines in any threads can share them.
+void init(const uint8_t* blob, uint64_t size)
+{
+#ifdef NNUE_LOAD_BLOB
+	if(blob)
+		load_weights(blob, size);
+	else
+#endif
+		decode_weights();
+	
+#ifndef NNUE_CRELU
+	for(int mask = 0; mask < 256; ++mask)
+		for(int bit = 0, n = 0; bit < 8; ++bit)
+			if(mask >> bit & 1)
+				active_indices[mask] |= static_cast<uint64_t>(bit) << 8 * n++;
+#endif
+	
+	check_accumulator_range();
+#ifdef DEBUGGING
+	printf("NNUE check: %d %d %d\n", PST[16 * INPUT_LAYER], PST[16 * INPUT_LAYER + 1], l4_bias[3]);
+#endif
+}
+
+//The weights built in: a blob with NNUE_BLOB, otherwise the compressed data
+void init_default()
+{
+#ifdef NNUE_BLOB
+	init(nnue_blob, nnue_blob_end - nnue_blob);
+#else
+	init(nullptr, 0);
+#endif
+}
+
+#ifdef NNUE_LOAD_BLOB
+//Startup option: use the weights blob in a file, mapped only while it is copied
+void load_weights_file(const char* path)
+{
+	int fd = open(path, O_RDONLY);
+	if(fd < 0)
+		reject_weights("NNUE weights file cannot be opened\n", 35);
+	uint64_t size = lseek(fd, 0, SEEK_END);
+	void* blob = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if(blob == MAP_FAILED)
+		reject_weights("NNUE weights file cannot be opened\n", 35);
+	
+	init(static_cast<const uint8_t*>(blob), size);
+	munmap(blob, size);
+}
+#endif
 
 #ifdef DEBUGGING
 void log(const char* s, int32_t *l, int n)
@@ -119,9 +373,120 @@ void log(const char* s, int32_t *l, int n)
 }
 #endif
 
-__attribute__((optimize("tree-vectorize"))) Value evaluate(int32_t * accumulator)
+int output_bucket(const Accumulator& acc)
+{
+	return 2 * (acc.queens > 0) + (acc.game_phase > 8);
+}
+
+#ifdef NNUE_CRELU
+//Scalar layers 1-4 from one perspective's accumulator. This is the reference for evaluate():
+//bench.cpp runs it on an int32 accumulator computed from scratch to check the two agree.
+template<typename T>
+Value evaluate_network(const T* accumulator, int bucket)
+{
+	int32_t l1_output[INPUT_LAYER];
+	int32_t l2_output[HIDDEN1];
+	int32_t l3_output[HIDDEN2];
+	
+	for(int i = 0; i < INPUT_LAYER; ++i)
+		l1_output[i] = std::clamp<int32_t>(accumulator[i], 0, L1_QUANTIZE);
+	
+	for(int j = 0; j < HIDDEN1; ++j)
+	{
+		int32_t sum = l2_bias[bucket][j];
+		for(int i = 0; i < INPUT_LAYER; ++i)
+			sum += l1_output[i] * l2_weights[bucket][j * INPUT_LAYER + i];
+		l2_output[j] = std::clamp(sum >> 6, 0, L1_QUANTIZE);
+	}
+	
+	for(int j = 0; j < HIDDEN2; ++j)
+	{
+		int32_t sum = l3_bias[bucket][j];
+		for(int i = 0; i < HIDDEN1; ++i)
+			sum += l2_output[i] * l3_weights[bucket][j * L3_INPUTS + i];
+		l3_output[j] = std::clamp(sum >> 6, 0, L1_QUANTIZE);
+	}
+	
+	int32_t result = l4_bias[bucket];
+	for(int i = 0; i < HIDDEN2; ++i)
+		result += l3_output[i] * l4_weights[bucket][i];
+	
+	return std::clamp(result / (L1_QUANTIZE * QUANTIZE), -20000, 20000);
+}
+
+//The 8 horizontal sums of s[0..7], in order
+__m256i horizontal_sums(const __m256i* s)
+{
+	__m256i a = _mm256_hadd_epi32(_mm256_hadd_epi32(s[0], s[1]), _mm256_hadd_epi32(s[2], s[3]));
+	__m256i b = _mm256_hadd_epi32(_mm256_hadd_epi32(s[4], s[5]), _mm256_hadd_epi32(s[6], s[7]));
+	return _mm256_add_epi32(_mm256_permute2x128_si256(a, b, 0x20), _mm256_permute2x128_si256(a, b, 0x31));
+}
+
+//bias + w * in for 8 outputs, with in as INPUTS uint8 activations and w as int8 rows. Pairs of
+//products are summed to int16 by vpmaddubsw, which cannot saturate since both activations are
+//at most 127, and then to int32 by vpmaddwd.
+template<int INPUTS>
+__m256i affine8(const __m256i* in, const int8_t* w, const int32_t* bias)
+{
+	const __m256i ones = _mm256_set1_epi16(1);
+	__m256i s[8];
+	for(int k = 0; k < 8; ++k)
+	{
+		s[k] = _mm256_setzero_si256();
+		for(int c = 0; c < INPUTS / 32; ++c)
+		{
+			__m256i products = _mm256_maddubs_epi16(in[c], _mm256_load_si256(reinterpret_cast<const __m256i*>(w + k * INPUTS + 32 * c)));
+			s[k] = _mm256_add_epi32(s[k], _mm256_madd_epi16(products, ones));
+		}
+	}
+	return _mm256_add_epi32(horizontal_sums(s), _mm256_load_si256(reinterpret_cast<const __m256i*>(bias)));
+}
+
+//Same result as evaluate_network(). Activations stay in registers as bytes; the 16 layer 2
+//outputs end up in the low half of the register that feeds layer 3, whose padded weights are
+//zero for the high half.
+Value evaluate(const Accumulator& acc, int perspective)
 {
-	int bucket = 2 * (queens > 0) + (game_phase > 8);
+	static_assert(INPUT_LAYER % 32 == 0 && HIDDEN1 == 16 && HIDDEN2 == 8, "evaluate() expects 32n -> 16 -> 8 layers");
+	int bucket = output_bucket(acc);
+	const int16_t* accumulator = acc.values[perspective];
+	const __m256i max_activation = _mm256_set1_epi8(L1_QUANTIZE);
+	
+	//Saturating packs clamp to 0..255, and the bytes come out of each 128-bit lane in turn
+	__m256i l1[INPUT_LAYER / 32];
+	for(int c = 0; c < INPUT_LAYER / 32; ++c)
+	{
+		__m256i x = _mm256_packus_epi16(_mm256_load_si256(reinterpret_cast<const __m256i*>(accumulator + 32 * c)),
+			_mm256_load_si256(reinterpret_cast<const __m256i*>(accumulator + 32 * c + 16)));
+		l1[c] = _mm256_permute4x64_epi64(_mm256_min_epu8(x, max_activation), 0xd8);
+	}
+	
+	__m256i low = _mm256_srai_epi32(affine8<INPUT_LAYER>(l1, l2_weights[bucket], l2_bias[bucket]), 6);
+	__m256i high = _mm256_srai_epi32(affine8<INPUT_LAYER>(l1, l2_weights[bucket] + 8 * INPUT_LAYER, l2_bias[bucket] + 8), 6);
+	__m256i x = _mm256_permute4x64_epi64(_mm256_packs_epi32(low, high), 0xd8);
+	x = _mm256_min_epu8(_mm256_packus_epi16(x, x), max_activation);
+	__m256i l2 = _mm256_permute4x64_epi64(x, 0x08);
+	
+	__m256i l3 = _mm256_srai_epi32(affine8<L3_INPUTS>(&l2, l3_weights[bucket], l3_bias[bucket]), 6);
+	l3 = _mm256_min_epi32(_mm256_max_epi32(l3, _mm256_setzero_si256()), _mm256_set1_epi32(L1_QUANTIZE));
+	
+	__m256i l4 = _mm256_mullo_epi32(l3, _mm256_load_si256(reinterpret_cast<const __m256i*>(l4_weights[bucket])));
+	__m128i sum = _mm_add_epi32(_mm256_castsi256_si128(l4), _mm256_extracti128_si256(l4, 1));
+	sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4e));
+	sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xb1));
+	int32_t result = l4_bias[bucket] + _mm_cvtsi128_si32(sum);
+	
+	return std::clamp(result / (L1_QUANTIZE * QUANTIZE), -20000, 20000);
+}
+#else
+//Scalar layers 1-4 from one perspective's accumulator. This is the reference for evaluate():
+//bench.cpp runs it on an int32 accumulator computed from scratch to check the two agree.
+template<typename T>
+__attribute__((optimize("tree-vectorize"))) Value evaluate_network(const T* accumulator, int bucket)
+{
+	alignas(32) int32_t l1_output[INPUT_LAYER];
+	alignas(32) int32_t l2_output[HIDDEN1];
+	alignas(32) int32_t l3_output[HIDDEN2];
 	
 	for(int i = 0; i < INPUT_LAYER; ++i)
 		l1_output[i] = accumulator[i] * (accumulator[i] > 0);
@@ -137,7 +502,7 @@ __attribute__((optimize("tree-vectorize"))) Value evaluate(int32_t * accumulator
 	
 	for(int j = 0; j < HIDDEN1; ++j)
 		for(int i = 0; i < INPUT_LAYER; ++i)
-			l2_output[j] += l1_output[i] * l2_weights[bucket][j * INPUT_LAYER + i] >> FIXED_POINT;
+			l2_output[j] += l1_output[i] * l2_weights[bucket][i * HIDDEN1 + j] >> FIXED_POINT;
 	
 	for(int i = 0; i < HIDDEN1; ++i)
 #ifdef SOFTRELU_BUG
@@ -159,7 +524,7 @@ __attribute__((optimize("tree-vectorize"))) Value evaluate(int32_t * accumulator
 	
 	for(int j = 0; j < HIDDEN2; ++j)
 		for(int i = 0; i < HIDDEN1; ++i)
-			l3_output[j] += l2_output[i] * l3_weights[bucket][j * HIDDEN1 + i] >> FIXED_POINT;
+			l3_output[j] += l2_output[i] * l3_weights[bucket][i * HIDDEN2 + j] >> FIXED_POINT;
 		
 	for(int i = 0; i < HIDDEN2; ++i)
 		l3_output[i] = l3_output[i] * (l3_output[i] > 0) + (l3_output[i] >> 4);
@@ -182,52 +547,200 @@ __attribute__((optimize("tree-vectorize"))) Value evaluate(int32_t * accumulator
 	return std::clamp(result >> FIXED_POINT, -20000, 20000);
 }
 
-void clear_accumulator()
+//x * (x > 0) + (x >> 4), 8 at a time
+__m256i soft_relu(__m256i x)
 {
-	static bool initialized = false;
+	return _mm256_add_epi32(_mm256_max_epi32(x, _mm256_setzero_si256()), _mm256_srai_epi32(x, 4));
+}
+
+//sum += (broadcast(input) * w) >> FIXED_POINT for each of 8 int32 lanes
+__m256i multiply_add(__m256i sum, const int32_t* input, const int32_t* w)
+{
+	__m256i x = _mm256_mullo_epi32(_mm256_set1_epi32(*input), _mm256_load_si256(reinterpret_cast<const __m256i*>(w)));
+	return _mm256_add_epi32(sum, _mm256_srai_epi32(x, FIXED_POINT));
+}
+
+//Same result as evaluate_network(). The shift after every product rules out vpmaddwd, so each
+//input is broadcast and multiplied with its row of transposed weights and the layer outputs
+//stay in registers. Layer 2 inputs and weights both fit in int16, so vpmullw/vpmulhw give 16
+//full products at a time; interleaving the low and high halves yields outputs 0-3,8-11 and
+//4-7,12-15 as int32, which are put back in order once at the end. Only inputs that survive the
+//ReLU are multiplied: a compare and movemask list them, and each has its own weight row.
+//Layer 3 inputs are read back from a small stack buffer, since a broadcast from memory is
+//cheaper than a shuffle.
+Value evaluate(const Accumulator& acc, int perspective)
+{
+	static_assert(INPUT_LAYER % 16 == 0 && HIDDEN1 % 16 == 0 && HIDDEN2 == 8, "evaluate() works on 16 neurons at a time");
+	int bucket = output_bucket(acc);
+#ifdef DEBUGGING
+	if(verbose) return evaluate_network(acc.values[perspective], bucket);
+#endif
+	const int16_t* accumulator = acc.values[perspective];
+	uint8_t active[INPUT_LAYER + 8];
+	int n_active = 0;
+	alignas(32) int32_t l2_output[HIDDEN1];
 	
-	if(!initialized)
+	//movemask gives two bits per int16 and pext keeps one. Each byte of the mask then writes its
+	//8 possible indices at once and advances by its popcount, so there are no branches.
+	uint64_t mask = 0;
+	for(int i = 0; i < INPUT_LAYER; i += 16)
 	{
-		init();
-		initialized = true;
-#ifdef DEBUGGING
-		printf("NNUE check: %d %d %d\n", PST[16 * INPUT_LAYER], PST[16 * INPUT_LAYER + 1], l4_bias[3]);
+		__m256i positive = _mm256_cmpgt_epi16(_mm256_load_si256(reinterpret_cast<const __m256i*>(accumulator + i)), _mm256_setzero_si256());
+		mask |= static_cast<uint64_t>(_pext_u32(_mm256_movemask_epi8(positive), 0x55555555)) << i;
+	}
+	for(int i = 0; i < INPUT_LAYER; i += 8)
+	{
+		uint64_t indices = active_indices[mask >> i & 255] + i * 0x0101010101010101ull;
+		__builtin_memcpy(active + n_active, &indices, 8);
+		n_active += __builtin_popcount(mask >> i & 255);
+	}
+#ifdef NNUE_STATS
+	l1_active_histogram[n_active]++;
 #endif
+	
+	__m256i l2[HIDDEN1 / 8] = {};
+	for(int k = 0; k < n_active; ++k)
+	{
+		int i = active[k];
+		__m256i x = _mm256_set1_epi16(accumulator[i]);
+		for(int j = 0; j < HIDDEN1 / 16; ++j)
+		{
+			__m256i w = _mm256_load_si256(reinterpret_cast<const __m256i*>(l2_weights[bucket] + i * HIDDEN1 + 16 * j));
+			__m256i low = _mm256_mullo_epi16(x, w);
+			__m256i high = _mm256_mulhi_epi16(x, w);
+			l2[2*j] = _mm256_add_epi32(l2[2*j], _mm256_srai_epi32(_mm256_unpacklo_epi16(low, high), FIXED_POINT));
+			l2[2*j + 1] = _mm256_add_epi32(l2[2*j + 1], _mm256_srai_epi32(_mm256_unpackhi_epi16(low, high), FIXED_POINT));
+		}
+	}
+	for(int j = 0; j < HIDDEN1 / 16; ++j)
+	{
+		__m256i a = _mm256_permute2x128_si256(l2[2*j], l2[2*j + 1], 0x20);
+		__m256i b = _mm256_permute2x128_si256(l2[2*j], l2[2*j + 1], 0x31);
+		l2[2*j] = _mm256_add_epi32(a, _mm256_load_si256(reinterpret_cast<const __m256i*>(l2_bias[bucket] + 16 * j)));
+		l2[2*j + 1] = _mm256_add_epi32(b, _mm256_load_si256(reinterpret_cast<const __m256i*>(l2_bias[bucket] + 16 * j + 8)));
 	}
+	for(int j = 0; j < HIDDEN1 / 8; ++j)
+	{
+#ifdef SOFTRELU_BUG
+		l2[j] = _mm256_max_epi32(l2[j], _mm256_setzero_si256());
+#else
+		l2[j] = soft_relu(l2[j]);
+#endif
+		_mm256_store_si256(reinterpret_cast<__m256i*>(l2_output + 8 * j), l2[j]);
+	}
+	
+	__m256i l3 = _mm256_load_si256(reinterpret_cast<const __m256i*>(l3_bias[bucket]));
+	for(int i = 0; i < HIDDEN1; ++i)
+		l3 = multiply_add(l3, l2_output + i, l3_weights[bucket] + i * HIDDEN2);
+	l3 = soft_relu(l3);
 	
+	__m256i l4 = _mm256_srai_epi32(_mm256_mullo_epi32(l3, _mm256_load_si256(reinterpret_cast<const __m256i*>(l4_weights[bucket]))), FIXED_POINT);
+	__m128i sum = _mm_add_epi32(_mm256_castsi256_si128(l4), _mm256_extracti128_si256(l4, 1));
+	sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4e));
+	sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xb1));
+	int32_t result = l4_bias[bucket] + _mm_cvtsi128_si32(sum);
+	
+	return std::clamp(result >> FIXED_POINT, -20000, 20000);
+}
+#endif
+
+void clear_accumulator(Accumulator& acc)
+{
 	for(int i = 0; i < INPUT_LAYER; ++i)
 	{
-		accumulator[0][i] = l1_bias[i];
-		accumulator[1][i] = l1_bias[i];
+		acc.values[0][i] = l1_bias[i];
+		acc.values[1][i] = l1_bias[i];
 	}
-	game_phase = 0;
-	queens = 0;
+	acc.game_phase = 0;
+	acc.queens = 0;
 }
 
 int pst_phase[] = {0,1,1,2,0,0,0,1,1,2,0,0};
 
-__attribute__((optimize("tree-vectorize"))) void add_accumulator(int piece, int square)
+__attribute__((optimize("tree-vectorize"))) void add_accumulator(Accumulator& acc, int piece, int square)
 {
 	for(int i = 0; i < INPUT_LAYER; ++i)
 	{
-		accumulator[0][i] += PST[piece * 64 * INPUT_LAYER + square * INPUT_LAYER + i];
-		accumulator[1][i] += PST[(piece > 5 ? piece - 6 : piece + 6) * 64 * INPUT_LAYER + (square ^ 56) * INPUT_LAYER + i];
+		acc.values[0][i] += PST[piece * 64 * INPUT_LAYER + square * INPUT_LAYER + i];
+		acc.values[1][i] += PST[(piece > 5 ? piece - 6 : piece + 6) * 64 * INPUT_LAYER + (square ^ 56) * INPUT_LAYER + i];
 	}
 	
-	queens += (piece == 4) + (piece == 10);
-	game_phase += pst_phase[piece];
+	acc.queens += (piece == 4) + (piece == 10);
+	acc.game_phase += pst_phase[piece];
 }
 
-__attribute__((optimize("tree-vectorize"))) void remove_accumulator(int piece, int square)
+__attribute__((optimize("tree-vectorize"))) void remove_accumulator(Accumulator& acc, int piece, int square)
 {
 	for(int i = 0; i < INPUT_LAYER; ++i)
 	{
-		accumulator[0][i] -= PST[piece * 64 * INPUT_LAYER + square * INPUT_LAYER + i];
-		accumulator[1][i] -= PST[(piece > 5 ? piece - 6 : piece + 6) * 64 * INPUT_LAYER + (square ^ 56) * INPUT_LAYER + i];
+		acc.values[0][i] -= PST[piece * 64 * INPUT_LAYER + square * INPUT_LAYER + i];
+		acc.values[1][i] -= PST[(piece > 5 ? piece - 6 : piece + 6) * 64 * INPUT_LAYER + (square ^ 56) * INPUT_LAYER + i];
+	}
+	
+	acc.queens -= (piece == 4) + (piece == 10);
+	acc.game_phase -= pst_phase[piece];
+}
+
+const int16_t* pst_row(int perspective, int piece, int square)
+{
+	if(perspective == 1)
+	{
+		piece = piece > 5 ? piece - 6 : piece + 6;
+		square ^= 56;
+	}
+	return PST + piece * 64 * INPUT_LAYER + square * INPUT_LAYER;
+}
+
+//One perspective of an accumulator update: out = in - removed rows + added rows, 16 neurons
+//per step
+template<int REMOVED, int ADDED>
+void update_perspective(const int16_t* in, int16_t* out, const int16_t* const* removed, const int16_t* const* added)
+{
+	static_assert(INPUT_LAYER % 16 == 0, "update_perspective works on 16 neurons at a time");
+	for(int i = 0; i < INPUT_LAYER; i += 16)
+	{
+		__m256i x = _mm256_load_si256(reinterpret_cast<const __m256i*>(in + i));
+		for(int j = 0; j < REMOVED; ++j)
+			x = _mm256_sub_epi16(x, _mm256_load_si256(reinterpret_cast<const __m256i*>(removed[j] + i)));
+		for(int j = 0; j < ADDED; ++j)
+			x = _mm256_add_epi16(x, _mm256_load_si256(reinterpret_cast<const __m256i*>(added[j] + i)));
+		_mm256_store_si256(reinterpret_cast<__m256i*>(out + i), x);
+	}
+}
+
+//to = from with a move's changes applied, in one pass over each perspective
+void update_accumulator(const Accumulator& from, Accumulator& to, const AccumulatorDelta& delta)
+{
+	for(int p = 0; p < 2; ++p)
+	{
+		const int16_t* removed[2];
+		const int16_t* added[2];
+		for(int i = 0; i < delta.n_removed; ++i)
+			removed[i] = pst_row(p, delta.removed[i][0], delta.removed[i][1]);
+		for(int i = 0; i < delta.n_added; ++i)
+			added[i] = pst_row(p, delta.added[i][0], delta.added[i][1]);
+		
+		//Quiet moves and promotions; captures, en passant and capture promotions; castling
+		if(delta.n_removed == 1)
+			update_perspective<1, 1>(from.values[p], to.values[p], removed, added);
+		else if(delta.n_added == 1)
+			update_perspective<2, 1>(from.values[p], to.values[p], removed, added);
+		else
+			update_perspective<2, 2>(from.values[p], to.values[p], removed, added);
 	}
 	
-	queens -= (piece == 4) + (piece == 10);
-	game_phase -= pst_phase[piece];
+	to.queens = from.queens;
+	to.game_phase = from.game_phase;
+	for(int i = 0; i < delta.n_removed; ++i)
+	{
+		to.queens -= (delta.removed[i][0] == 4) + (delta.removed[i][0] == 10);
+		to.game_phase -= pst_phase[delta.removed[i][0]];
+	}
+	for(int i = 0; i < delta.n_added; ++i)
+	{
+		to.queens += (delta.added[i][0] == 4) + (delta.added[i][0] == 10);
+		to.game_phase += pst_phase[delta.added[i][0]];
+	}
 }
 
 } //namespace nnue
\ No newline at end of file
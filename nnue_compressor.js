@@ -1,9 +1,11 @@
 const fs = require('fs');
 const base = 256;
 const quantize = 64;
-const nnue_file = 'weight_NNUE3o4_64_16_8_s0.txt';
+const crelu = false;  //clipped ReLU network from Evaluator_NNUE3_CReLU: layer 1 at 1/127, for the engine's NNUE_CRELU path
+const l1_quantize = crelu ? 127 : quantize;
+const nnue_file = crelu ? 'weight_NNUE3_crelu_64_16_8_s0.txt' : 'weight_NNUE3o4_64_16_8_s0.txt';
 const nnue_layers = [64, 16, 8];
-const cpp_out = nnue_layers[0] + "_" + nnue_layers[1] + "_" + nnue_layers[2] + "_q" + quantize + '.cpp';
+const cpp_out = nnue_layers[0] + "_" + nnue_layers[1] + "_" + nnue_layers[2] + "_q" + quantize + (crelu ? "_crelu" : "") + '.cpp';
 const nnue_out = 'NNUE_quantized.txt';
 
 function startDecode()
@@ -289,25 +291,35 @@ for(let piece = 0; piece < 6; ++piece)
 				if(piece == 0 && (square < 8 || square >= 56))
 					continue;
 				
-				let quantized = Math.round(chunks[0][i]*quantize)/quantize;
+				//all_data holds multiples of 1/quantize, which layer 1 of a clipped ReLU network is rescaled to
+				let quantized = Math.round(chunks[0][i]*l1_quantize);
 				
 				if(square == 0 || (square == 8 && piece == 0))
-					all_data.push(quantized)
+					all_data.push(quantized / quantize)
 				else
-					all_data.push(quantized - Math.round(chunks[0][i-a]*quantize)/quantize);
-				all_data_uncompressed.push(quantized);
+					all_data.push((quantized - Math.round(chunks[0][i-a]*l1_quantize)) / quantize);
+				all_data_uncompressed.push(quantized / l1_quantize);
 			}
 if(i != 768 * a)
 	console.log("ERROR i != 768", i);
 
-for(i = 1; i < chunks.length; ++i)
+for(const x of chunks[1])
+	all_data.push(Math.round(x * l1_quantize) / quantize);
+
+for(i = 2; i < chunks.length; ++i)
 	for(const x of chunks[i])
+	{
+		if(crelu && (i % 6 == 2 || i % 6 == 4) && Math.abs(Math.round(x * quantize)) > 127)
+			throw "hidden weight does not fit int8: " + x;
 		all_data.push(x);
+	}
 	
 console.log("all data length:", all_data.length);
 
-let buckets = Array(15).fill(0);
-let signs   = Array(15).fill(0);
+//One bucket per bit length; the output weights of a clipped ReLU network need more than 14 bits
+const max_bits = Math.max(...all_data.map(x => Math.abs(Math.round(x * quantize)).toString(2).length));
+let buckets = Array(Math.max(15, max_bits + 1)).fill(0);
+let signs   = Array(Math.max(15, max_bits + 1)).fill(0);
 for(let x of all_data)
 {
 	let b = 0;
@@ -443,6 +455,7 @@ try {
 		"\n#define HIDDEN1 "+hidden1,
 		"\n#define HIDDEN2 "+hidden2,
 		"\n#define QUANTIZE "+quantize,
+		crelu ? "\n#define NNUE_CRELU 1\n#define L1_QUANTIZE "+l1_quantize : "",
 		"\n\nuint32_t thresholds[] = {" + cutoffs.join(",") + "};\nuint8_t compressed_data[] = {"
 	];
 	for(let i = 0; i < encoded.length; ++i)
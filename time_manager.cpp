@@ -0,0 +1,152 @@
+/*
+Time management: how long to think about a move. The limits come from the time left, the
+increment and the latency (time that passes on our clock but not in our search), and the
+soft limit then stretches or shrinks with how stable the search is.
+*/
+
+//Soft limit before stability changes it, as a percentage of the move's base time. The search
+//stops after the first iteration that ends past it, so on average it overshoots.
+#ifndef TIME_SOFT_PERCENT
+#define TIME_SOFT_PERCENT 20
+#endif
+
+//Hard limit, as a multiple of the base time (but at most a quarter of the time left)
+#ifndef TIME_HARD_FACTOR
+#define TIME_HARD_FACTOR 3
+#endif
+
+//Best move share of an iteration's nodes over which the search stops at half the soft limit
+#define TIME_DOMINANT_PERCENT 85
+
+//Skip an iteration that is predicted to end past the hard limit, since stopping it there
+//throws its work away. 0 to always start the next iteration while under the soft limit.
+#ifndef TIME_PREDICT
+#define TIME_PREDICT 1
+#endif
+
+enum StopReason : uint8_t
+{
+	STOP_NONE,
+	STOP_DEPTH,  //finished, at the depth limit
+	STOP_SOFT,
+	STOP_HARD,
+	STOP_NODES,
+	STOP_INPUT,
+	STOP_PREDICTED  //the next iteration would not end by the hard limit
+};
+
+#ifdef DIAGNOSTICS
+const char* const STOP_REASONS[] = {"none", "depth", "soft", "hard", "nodes", "input", "predicted"};
+#endif
+
+//ns from the start of the search
+struct TimeLimits
+{
+	uint64_t base;  //what a move should take on average
+	uint64_t soft;  //no new iteration after this
+	uint64_t hard;  //the search is stopped here
+};
+
+TimeLimits time_limits(uint64_t remaining, uint64_t increment, uint64_t latency, uint64_t moves_to_go)
+{
+	uint64_t base = remaining / moves_to_go + increment * 3 / 4;
+	base = std::min(base - std::min(base, latency), remaining / 2);
+	base = std::max<uint64_t>(base, 1'000'000);  //at least 1ms, so the search can finish depth 1
+	uint64_t hard = std::min(base * TIME_HARD_FACTOR, std::max(base, remaining / 4));
+	return {base, std::min(base * TIME_SOFT_PERCENT / 100, hard), hard};
+}
+
+//A fixed time (movetime, pondering), which stability does not change
+TimeLimits fixed_time(uint64_t time)
+{
+	return {UINT64_MAX, time, time};
+}
+
+//Its functions run once an iteration at most, so they are cold (optimized for size)
+struct TimeManager
+{
+	TimeLimits limits = fixed_time(UINT64_MAX);
+	
+	//How the search has gone so far. A ponder hit changes the limits but keeps these.
+	Move last_best;
+	Value last_value;
+	int best_changes;  //in eighths, halved every iteration
+	uint64_t scale;    //of the soft limit, in percent
+	
+	//Iteration cost: nodes grow by about the same factor from one iteration to the next, so
+	//the next one takes about the last one's time times that. Times are monotonic_ns(), so
+	//they stay valid when a ponder hit restarts the clock.
+	uint64_t growth = 300;  //nodes of an iteration over the one before, in percent, smoothed over searches
+	uint64_t last_nodes;
+	uint64_t last_end;      //when the last iteration finished
+	uint64_t predicted;     //ns the next one will take (0 until two have finished)
+	
+#ifdef DIAGNOSTICS
+	//ns over all moves: thought, and spent on an iteration that did not finish
+	uint64_t used = 0;
+	uint64_t wasted = 0;
+#endif
+	
+	//At the start of a move's search (or of pondering on one)
+	void new_search()
+	{
+		last_best = Move::NO_MOVE;
+		last_value = TT_NO_VALUE;
+		best_changes = 0;
+		scale = 100;
+		last_nodes = 0;
+		last_end = 0;
+		predicted = 0;
+	}
+	
+	//After each iteration the main thread finishes at now (nodes over all its re-searches):
+	//rescales the soft limit and predicts the next iteration's time. A best move that keeps
+	//changing or a falling score stretch the soft limit, up to 2x each, and a best move that
+	//took nearly all of the iteration's nodes halves it.
+	__attribute__((cold)) void iteration_done(int depth, Move best, Value v, uint64_t best_nodes, uint64_t nodes, uint64_t now)
+	{
+		if(last_nodes)
+		{
+			growth = (growth + std::clamp<uint64_t>(nodes * 100 / last_nodes, 100, 1000)) / 2;
+			predicted = (now - last_end) * growth / 100;
+		}
+		last_nodes = nodes;
+		last_end = now;
+		
+		best_changes = best_changes / 2 + (last_best != Move::NO_MOVE && best != last_best ? 8 : 0);
+		int drop = last_value == TT_NO_VALUE ? 0 : std::clamp(last_value - v, 0, 100);
+		last_best = best;
+		last_value = v;
+		
+		scale = (100 + std::min(best_changes, 16) * 100 / 16) * (100 + drop) / 100;
+		if(depth >= 6 && best_nodes * 100 >= nodes * TIME_DOMINANT_PERCENT)
+			scale /= 2;
+	}
+	
+	//Why to stop elapsed ns into the search (at now), as of the last iteration it finished
+	//(STOP_NONE to go on, or before the first). Run after each iteration, and when a ponder hit
+	//gives new limits in the middle of one, which is then the iteration predicted to end.
+	__attribute__((cold)) StopReason check(uint64_t elapsed, uint64_t now)
+	{
+		if(limits.base != UINT64_MAX)
+			limits.soft = std::min(limits.base * TIME_SOFT_PERCENT / 100 * scale / 100, limits.hard);
+		if(last_best == Move::NO_MOVE)
+			return STOP_NONE;
+		if(elapsed >= limits.soft)
+			return STOP_SOFT;
+#if TIME_PREDICT
+		if(limits.hard != UINT64_MAX && elapsed + predicted > limits.hard + (now - last_end))
+			return STOP_PREDICTED;
+#endif
+		return STOP_NONE;
+	}
+	
+#ifdef DIAGNOSTICS
+	//When the search for a move that took time ns ends at now
+	void move_done(uint64_t time, uint64_t now)
+	{
+		used += time;
+		wasted += std::min(now - last_end, time);
+	}
+#endif
+};
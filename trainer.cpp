@@ -3,6 +3,9 @@ Build: g++ -std=c++20 -O2 trainer.cpp -o trainer
 */
 
 #define PRINT_EVAL 0
+#ifndef CRELU
+#define CRELU 0  //train Evaluator_NNUE3_CReLU instead of Evaluator_NNUE3_Multi
+#endif
 
 #include "nnue_training_data_formats.h"
 
@@ -2935,6 +2938,265 @@ struct Evaluator_NNUE3_Multi
 	}
 };
 
+//Clipped ReLU version of Evaluator_NNUE3_Multi for the engine's int8/int16 inference path
+//(NNUE_CRELU). Every activation is clamped to 0..1 and the buckets are the engine's
+//(queens present, phase > 8). Hidden layer weights are clipped after each step so that they
+//quantize to int8 at 1/64. Export with nnue_compressor.js, crelu = true.
+struct Evaluator_NNUE3_CReLU
+{
+	ADConst PST;
+	ADConst l1_bias;
+	ADConst l2_weights[4];
+	ADConst l2_bias[4];
+	ADConst l3_weights[4];
+	ADConst l3_bias[4];
+	ADConst l4_weights[4];
+	ADConst l4_bias[4];
+	ADSparseProduct input;
+	ADLossFunc* loss[4];
+	std::vector<AD*> ad_stack[4];
+	std::vector<ADConst*> all_data;
+	constexpr static float abs_coeff = 0;
+	constexpr static float max_hidden_weight = 127.0f / 64.0f;
+	
+	Evaluator_NNUE3_CReLU(int hidden_size1, int hidden_size2, int hidden_size3) :
+		PST(768 * hidden_size1),
+		l1_bias(hidden_size1),
+		input(PST, hidden_size1)
+	{
+		all_data.push_back(&PST);
+		all_data.push_back(&l1_bias);
+		
+		for(int i = 0; i < 4; i++)
+		{
+			ad_stack[i].push_back(&PST);
+			ad_stack[i].push_back(&input);
+			ad_stack[i].push_back(&l1_bias);
+			
+			l2_weights[i] = ADConst(hidden_size1 * hidden_size2);
+			l2_bias[i] = ADConst(hidden_size2);
+			l3_weights[i] = ADConst(hidden_size2 * hidden_size3);
+			l3_bias[i] = ADConst(hidden_size3);
+			l4_weights[i] = ADConst(hidden_size3);
+			l4_bias[i] = ADConst(1);
+			
+			ad_stack[i].push_back(&l2_weights[i]);
+			ad_stack[i].push_back(&l2_bias[i]);
+			ad_stack[i].push_back(&l3_weights[i]);
+			ad_stack[i].push_back(&l3_bias[i]);
+			ad_stack[i].push_back(&l4_weights[i]);
+			ad_stack[i].push_back(&l4_bias[i]);
+			
+			all_data.push_back(&l2_weights[i]);
+			all_data.push_back(&l2_bias[i]);
+			all_data.push_back(&l3_weights[i]);
+			all_data.push_back(&l3_bias[i]);
+			all_data.push_back(&l4_weights[i]);
+			all_data.push_back(&l4_bias[i]);
+			
+			ADAdd *l1 = new ADAdd(input, l1_bias);
+			ad_stack[i].push_back(l1);
+			
+			ADCReLu *relu1 = new ADCReLu(*l1);
+			ad_stack[i].push_back(relu1);
+			
+			ADDenseProduct *dp = new ADDenseProduct(*relu1, l2_weights[i], hidden_size2);
+			ad_stack[i].push_back(dp);
+			
+			ADAdd *l2 = new ADAdd(*dp, l2_bias[i]);
+			ad_stack[i].push_back(l2);
+			
+			ADCReLu *relu2 = new ADCReLu(*l2);
+			ad_stack[i].push_back(relu2);
+			
+			ADDenseProduct *dp2 = new ADDenseProduct(*relu2, l3_weights[i], hidden_size3);
+			ad_stack[i].push_back(dp2);
+			
+			ADAdd *l3 = new ADAdd(*dp2, l3_bias[i]);
+			ad_stack[i].push_back(l3);
+			
+			ADCReLu *relu3 = new ADCReLu(*l3);
+			ad_stack[i].push_back(relu3);
+			
+			ADMult *l4 = new ADMult(*relu3, l4_weights[i]);
+			ad_stack[i].push_back(l4);
+			
+			ADSumReduce *output = new ADSumReduce(*l4);
+			ad_stack[i].push_back(output);
+			
+			AD *eval = new ADAdd(*output, l4_bias[i]);
+			ad_stack[i].push_back(eval);
+			
+			loss[i] = new ADLossFunc(*eval, abs_coeff);
+			ad_stack[i].push_back(loss[i]);
+		}
+		
+		int params = 0;
+		int i = 0;
+		for(auto data : all_data)
+		{
+			printf("Layer with %d params\n", data->size());
+			
+			float scale = 0.0f;
+			if(i == 0)
+				scale = .05f;
+			else if(i == 1)
+				scale = .25f;
+			else if(i%6 == 2)
+				scale = sqrt(2.0f / hidden_size1);
+			else if(i%6 == 3)
+				scale = .25f;
+			else if(i%6 == 4)
+				scale = sqrt(2.0f / hidden_size2);
+			else if(i%6 == 5)
+				scale = .25f;
+			else if(i%6 == 0)
+				scale = 1000.0f * sqrt(2.0f / hidden_size3);
+			else if(i%6 == 1)
+				scale = 1.0f;
+			
+			for(auto & x : data->values)
+			{
+				params++;
+				x = (random64() & 65535) / 65536.0f - 0.5f;
+				x *= scale * 2;
+			}
+			++i;
+		}
+		
+		printf("Network has %d parameters\n", params);
+	}
+	
+	void read(std::string file_name)
+	{
+		FILE* f = fopen(file_name.c_str(), "r");
+		if(!f)
+		{
+			printf("ERROR: Could not load file\n");
+			return;
+		}
+		for(auto data: all_data)
+			for(auto & x : data->values)
+			{
+				auto r = fscanf(f, "%f", &x);
+				if(r == EOF)
+				{
+					printf("ERROR: EOF\n");
+					break;
+				}
+			}
+			
+		fclose(f);
+		printf("Successfully read data\n");
+	}
+	
+	void process_input(const binpack::TrainingDataEntry& entry)
+	{
+		const Piece * pieces = entry.pos.piecesRaw();
+		input.indices.clear();
+		if(entry.pos.sideToMove() == Color::White)
+		{
+			for(int j = 0; j < 64; ++j)
+				if(pieces[j] != Piece::none())
+					input.indices.push_back(static_cast<int>(pieces[j]) * 64 + j);
+		}
+		else
+		{
+			for(int j = 0; j < 64; ++j)
+				if(pieces[j] != Piece::none())
+					input.indices.push_back((static_cast<int>(pieces[j])^1) * 64 + (j ^ 56));
+		}
+	}
+	
+	//Same buckets as nnue::output_bucket() in the engine
+	int get_phase(const binpack::TrainingDataEntry& entry)
+	{
+		static int pst_phase[] = {0,1,1,2,0,0};
+		int phase = 0;
+		bool queen = false;
+		const Piece * pieces = entry.pos.piecesRaw();
+		for(int j = 0; j < 64; ++j)
+			if(pieces[j].type() != PieceType::None)
+			{
+				phase += pst_phase[static_cast<int>(pieces[j].type())];
+				queen |= pieces[j].type() == PieceType::Queen;
+			}
+		return queen * 2 + (phase > 8);
+	}
+	
+	void update_gradient(const binpack::TrainingDataEntry& entry)
+	{
+		process_input(entry);
+		int phase = get_phase(entry);
+		loss[phase]->target = entry.score;
+		ad_calc_derivs(ad_stack[phase]);
+	}
+	
+	void step(float step_size)
+	{
+		float grad_length = 0.0f;
+		for(auto data : all_data)
+			for(int i = 0; i < data->size(); ++i)
+				grad_length += data->derivative[i] * data->derivative[i];
+
+		float mult = step_size / sqrt(grad_length) * .25f;
+		if(std::isinf(mult) || std::isnan(mult))
+			throw std::runtime_error("Bad mult " + std::to_string(mult) + " " + std::to_string(step_size) + " " + std::to_string(grad_length));
+		
+		for(auto data : all_data)
+			for(int i = 0; i < data->size(); ++i)
+				data->values[i] -= data->derivative[i] * mult;
+		
+		for(int h = 0; h < 4; ++h)
+		{
+			for(auto & x : l2_weights[h].values)
+				x = std::clamp(x, -max_hidden_weight, max_hidden_weight);
+			for(auto & x : l3_weights[h].values)
+				x = std::clamp(x, -max_hidden_weight, max_hidden_weight);
+		}
+	}
+	
+	void decay_gradient()
+	{
+		for(auto data : all_data)
+			for(auto & x : data->derivative)
+				x = 0.0f;
+	}
+	
+	void test()
+	{
+		float l = 0.0f;
+		float n = 0.0f;
+		
+		for(auto & entry : validation_data)
+		{
+			process_input(entry);
+			int phase = get_phase(entry);
+			loss[phase]->target = entry.score;
+			ad_calc_values(ad_stack[phase]);
+			l += loss[phase]->values[0];
+			n += 1.0f;
+		}
+		
+		printf("Loss: %.6f\n", l / n);
+	}
+	
+	void write(std::string & file_name)
+	{
+		FILE* f = fopen(file_name.c_str(), "w");
+		if(!f)
+		{
+			printf("ERROR: Could not save to log file\n");
+			return;
+		}
+		for(auto data: all_data)
+			for(auto x : data->values)
+				fprintf(f, "%.10f\n", x);
+			
+		fclose(f);
+	}
+};
+
 //////////////////////////////////////////////////////////////////////
 //main
 //////////////////////////////////////////////////////////////////////
@@ -2969,7 +3231,11 @@ std::tuple<double, double, double> win_rate_model(int ply, int score)
 
 int main()
 {
+#if CRELU
+	std::string weight_file = "weight_NNUE3_crelu_64_16_8_s0.txt";
+#else
 	std::string weight_file = "weight_NNUE3o5_64_16_8_s0.txt";	
+#endif
 	
 	int seed = 0;
 	printf("Output file: %s\n", weight_file.c_str());
@@ -2978,7 +3244,11 @@ int main()
 	for(int i = 0; i < 100000*seed; ++i)
 		random64();
 	
+#if CRELU
+	Evaluator_NNUE3_CReLU evaluator(64, 16, 8);
+#else
 	Evaluator_NNUE3_Multi evaluator(64, 16, 8);
+#endif
 	
 	//For starting training from existing weight files
 	//evaluator.read("weight_NNUE3_80_24_16_s0.txt");
@@ -1,10 +1,16 @@
 #define TT_NO_VALUE INT16_MIN
 #define ENTRIES_PER_CLUSTER 5
 
+//Default size, used unless a hash size is given at startup (TT_RESIZE builds)
 #ifndef TT_CLUSTERS
 #define TT_CLUSTERS 49152
 #endif
 
+#define TT_HUGE_PAGE (2 * 1024 * 1024)
+
+//Smaller tables use normal pages, so that the default table's memory use stays exact
+#define TT_HUGE_PAGE_MIN (16 * 1024 * 1024)
+
 //bound = 0 implies uninitialized
 enum TTBound : uint8_t
 {
@@ -16,12 +22,6 @@ enum TTBound : uint8_t
 
 using Collision_Resolver = uint32_t;
 
-static uint8_t TT_gen = 0;
-void advance_TT_gen()
-{
-	TT_gen += 4;
-}
-
 struct TTEntry
 {
 	Collision_Resolver hash;
@@ -30,71 +30,279 @@ struct TTEntry
 	Value search_eval;
 	uint8_t depth;
 	uint8_t gen_and_bound;  //high 6 bits = generation. Low 2 bits = bound type
+};
+static_assert(sizeof(TTEntry) == 12, "TTEntry Size wrong");
+
+//A TTEntry as stored in the table. With helper threads (SMP) it is shared by all
+//search threads without locks: it is accessed as three relaxed 32-bit words, and the
+//first word holds the hash XORed with the other two. An entry torn by a concurrent
+//write then fails the hash check and reads as a miss instead of returning another
+//position's data. Without helpers it is just the entry, written in place.
+struct TTSlot
+{
+#ifdef SMP
+	uint32_t words[3];
 	
-	void write(uint64_t hash_, uint16_t move_, Value static_eval_, Value search_eval_, int depth_, uint8_t bound_)
+	TTEntry load() const
 	{
+		uint32_t w[3];
+		for(int i = 0; i < 3; ++i)
+			w[i] = __atomic_load_n(&words[i], __ATOMIC_RELAXED);
+		w[0] ^= w[1] ^ w[2];
+		TTEntry entry;
+		__builtin_memcpy(&entry, w, sizeof(entry));
+		return entry;
+	}
+	
+	void store(const TTEntry& entry)
+	{
+		uint32_t w[3];
+		__builtin_memcpy(w, &entry, sizeof(entry));
+		w[0] ^= w[1] ^ w[2];
+		for(int i = 0; i < 3; ++i)
+			__atomic_store_n(&words[i], w[i], __ATOMIC_RELAXED);
+	}
+#else
+	TTEntry entry;
+	
+	TTEntry load() const { return entry; }
+	void store(const TTEntry& entry_) { entry = entry_; }
+#endif
+	
+	void write(uint64_t hash_, uint16_t move_, Value static_eval_, Value search_eval_, int depth_, uint8_t bound_, uint8_t gen)
+	{
+#ifdef SMP
+		TTEntry entry = load();
+#endif
+		
 		//Update move if we have one, or if this is a new entry
-		if(hash_ != hash || move_ != Move::NO_MOVE)
-			move = move_;
+		if(hash_ != entry.hash || move_ != Move::NO_MOVE)
+			entry.move = move_;
 
 		//Update everything else if this is a new entry or is more exact
-		if(hash_ != hash || bound_ == TTBound::EXACT || depth_ >= depth)
+		if(hash_ != entry.hash || bound_ == TTBound::EXACT || depth_ >= entry.depth)
 		{
-			hash = static_cast<Collision_Resolver>(hash_);
-			move = move_;
-			static_eval = static_eval_;
-			search_eval = search_eval_;
-			depth = std::max(0, std::min(255, depth_));
-			gen_and_bound = bound_ | TT_gen;
+			entry.hash = static_cast<Collision_Resolver>(hash_);
+			entry.move = move_;
+			entry.static_eval = static_eval_;
+			entry.search_eval = search_eval_;
+			entry.depth = std::max(0, std::min(255, depth_));
+			entry.gen_and_bound = bound_ | gen;
 		}
+		
+#ifdef SMP
+		store(entry);
+#endif
 	}
 };
-static_assert(sizeof(TTEntry) == 12, "TTEntry Size wrong");
+static_assert(sizeof(TTSlot) == 12, "TTSlot Size wrong");
 
 struct TTCluster
 {
-	TTEntry entries[ENTRIES_PER_CLUSTER];
-	char padding[4];
+	TTSlot entries[ENTRIES_PER_CLUSTER];
+	uint32_t epoch;  //entries are only valid if this matches the table's epoch
 };
 static_assert(sizeof(TTCluster) == 64, "TTCluster size wrong");
 
-alignas(64) TTCluster TT[TT_CLUSTERS];
+//slot is where to write; entry is a consistent copy of its contents when probed
+struct TTRef
+{
+	TTSlot& slot;
+	TTEntry entry;
+	bool found;
+	uint8_t gen;
+	
+	void write(uint64_t hash_, uint16_t move_, Value static_eval_, Value search_eval_, int depth_, uint8_t bound_)
+	{
+		slot.write(hash_, move_, static_eval_, search_eval_, depth_, bound_, gen);
+	}
+};
+
+//One engine's table. Entries are keyed by the full position hash, so nothing in here
+//depends on the engine, but each engine clears and ages only its own.
+struct TranspositionTable
+{
+	TTCluster* clusters;
+	uint64_t n_clusters;
+	void* mem;
+	uint64_t bytes;  //mapped, which can be more than the clusters because of huge page alignment
+	bool hugetlb;
+	uint8_t gen = 0;
+	bool prefetching = false;  //only pays off once the table is much bigger than the cache
+	
+	//Clearing the table just advances the epoch; each cluster is then emptied the
+	//first time it is probed, so a new game costs the same at any table size.
+	uint32_t epoch = 1;
+	
+	void init(uint64_t clusters_);
+	uint64_t page_size();
+	
+	void advance_gen()
+	{
+		gen += 4;
+	}
+	
+	int age(const TTEntry& entry)
+	{
+		return (64 + gen - (entry.gen_and_bound >> 2)) & 63;
+	}
+	
+	TTCluster& cluster(uint64_t hash)
+	{
+		return clusters[(static_cast<unsigned __int128>(n_clusters) * static_cast<unsigned __int128>(hash)) >> 64];
+	}
+	
+	TTRef get(uint64_t hash);
+	void clear();
+#ifdef UCI
+	int hashfull();
+#endif
+};
+
+//Allocates the table with mmap. With TT_RESIZE, large tables ask for huge pages, first
+//explicitly (MAP_HUGETLB, which needs pages reserved in the kernel's pool) and otherwise
+//transparently (MADV_HUGEPAGE), aligning the table to a huge page boundary.
+void TranspositionTable::init(uint64_t clusters_)
+{
+	if(mem)
+		munmap(mem, bytes);
+	
+	n_clusters = std::max<uint64_t>(clusters_, 1);
+	bytes = n_clusters * sizeof(TTCluster);
+	mem = MAP_FAILED;
+	hugetlb = false;
+	
+#ifdef TT_RESIZE
+	bool huge = bytes >= TT_HUGE_PAGE_MIN;
+	prefetching = huge;
+	if(huge)
+	{
+		bytes = (bytes + TT_HUGE_PAGE - 1) & ~static_cast<uint64_t>(TT_HUGE_PAGE - 1);
+		mem = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+		hugetlb = mem != MAP_FAILED;
+		if(!hugetlb)
+			bytes += TT_HUGE_PAGE;  //slack for alignment
+	}
+#endif
+	
+	if(mem == MAP_FAILED)
+		mem = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	
+	if(mem == MAP_FAILED)
+	{
+		print_err("TT allocation failed\n", 21);
+		exit(-1);
+	}
+	
+	uintptr_t start = reinterpret_cast<uintptr_t>(mem);
+#ifdef TT_RESIZE
+	if(huge && !hugetlb)
+	{
+		start = (start + TT_HUGE_PAGE - 1) & ~static_cast<uintptr_t>(TT_HUGE_PAGE - 1);
+		madvise(reinterpret_cast<void*>(start), n_clusters * sizeof(TTCluster), MADV_HUGEPAGE);
+	}
+#endif
+	clusters = reinterpret_cast<TTCluster*>(start);
+	
+	//Fault the pages in now rather than during the first search (the mapping is zero-filled anyway)
+	for(uint64_t i = 0; i < n_clusters; i += 4096 / sizeof(TTCluster))
+		__atomic_store_n(&clusters[i].epoch, 0, __ATOMIC_RELAXED);
+}
+
+#ifdef TT_RESIZE
 
-int TT_age(TTEntry& entry)
+//Page size the table actually got. Transparent huge pages are only known from the
+//kernel's count of huge pages, once init() has touched the table.
+uint64_t TranspositionTable::page_size()
 {
-	return (64 + TT_gen - (entry.gen_and_bound >> 2)) & 63;
+	if(hugetlb)
+		return TT_HUGE_PAGE;
+	if(bytes < TT_HUGE_PAGE_MIN)
+		return 4096;
+	
+	char buf[4096];
+	int fd = open("/proc/self/smaps_rollup", O_RDONLY);
+	if(fd < 0)
+		return 4096;
+	int n = read(fd, buf, sizeof(buf) - 1);
+	close(fd);
+	buf[std::max(n, 0)] = 0;
+	
+	const char* key = "AnonHugePages:";
+	for(char* p = buf; *p; ++p)
+	{
+		int i = 0;
+		while(key[i] && p[i] == key[i])
+			++i;
+		if(key[i] == 0)
+		{
+			p += i;
+			while(*p == ' ')
+				++p;
+			//most of the table in huge pages?
+			return static_cast<uint64_t>(parse_num(p)) * 1024 >= n_clusters * sizeof(TTCluster) / 2 ? TT_HUGE_PAGE : 4096;
+		}
+	}
+	return 4096;
 }
+#endif
 
-struct TTRef
+//The table this thread's Board::makeMove()/makeNullMove() prefetch from: its engine's, set
+//when it starts searching, or nullptr if that table is too small to prefetch. Only
+//TT_RESIZE builds can have a table that big.
+#ifdef TT_RESIZE
+thread_local TranspositionTable* prefetch_table = nullptr;
+#endif
+
+//Called by Board::makeMove()/makeNullMove(), so the cluster is on its way to the
+//cache while the move is finished and the child node starts
+void prefetch_TT([[maybe_unused]] uint64_t hash)
 {
-	TTEntry& entry;
-	bool found;
-};
+#ifdef TT_RESIZE
+	if(prefetch_table)
+		__builtin_prefetch(&prefetch_table->cluster(hash));
+#endif
+}
 
-TTRef get_TTEntry(uint64_t hash)
+TTRef TranspositionTable::get(uint64_t hash)
 {
-	auto& cluster = TT[(static_cast<unsigned __int128>(TT_CLUSTERS) * static_cast<unsigned __int128>(hash)) >> 64];
+	auto& cluster = this->cluster(hash);
 	auto resolver = static_cast<Collision_Resolver>(hash);
+	TTEntry entries[ENTRIES_PER_CLUSTER];
+	
+	//First probe since the table was cleared
+	if(__atomic_load_n(&cluster.epoch, __ATOMIC_RELAXED) != epoch)
+	{
+		for(int i = 0; i < ENTRIES_PER_CLUSTER; ++i)
+			cluster.entries[i].store(TTEntry{0, Move::NO_MOVE, TT_NO_VALUE, TT_NO_VALUE, 0, 0});
+		__atomic_store_n(&cluster.epoch, epoch, __ATOMIC_RELAXED);
+	}
 	
 	//Look for exact match
 	for(int i = 0; i < ENTRIES_PER_CLUSTER; ++i)
 	{
-		TTEntry& entry = cluster.entries[i];
+		TTEntry& entry = entries[i];
+		entry = cluster.entries[i].load();
 		if(entry.hash == resolver)
 		{
-			//Reading already means the entry was useful, so update the generation
+			//Reading already means the entry was useful, so update the generation. Only
+			//write when it changes, so that probes alone don't write to shared entries.
 			//todo: test whether this actually helps elo
-			entry.gen_and_bound = TT_gen | (entry.gen_and_bound & 3);
-			return TTRef{entry, true};
+			if((entry.gen_and_bound & ~3) != gen)
+			{
+				entry.gen_and_bound = gen | (entry.gen_and_bound & 3);
+				cluster.entries[i].store(entry);
+			}
+			return TTRef{cluster.entries[i], entry, true, gen};
 		}
 	}
 	
 	//Find best replacement
 	int best = 0;
-	int best_score = cluster.entries[best].depth - 8 * TT_age(cluster.entries[best]);
+	int best_score = entries[best].depth - 8 * age(entries[best]);
 	for(int i = 1; i < ENTRIES_PER_CLUSTER; ++i)
 	{
-		int score = cluster.entries[i].depth - 8 * TT_age(cluster.entries[i]);
+		int score = entries[i].depth - 8 * age(entries[i]);
 		if(score < best_score)
 		{
 			best = i;
@@ -102,12 +310,97 @@ TTRef get_TTEntry(uint64_t hash)
 		}
 	}
 		
-	return TTRef{cluster.entries[best], false};
+	return TTRef{cluster.entries[best], entries[best], false, gen};
+}
+
+#ifdef UCI
+//Entries written by the current search, per 1000 of the first 1000 entries (UCI hashfull)
+int TranspositionTable::hashfull()
+{
+	int used = 0, n = 0;
+	for(uint64_t i = 0; i < n_clusters && n < 1000; ++i)
+	{
+		bool current = __atomic_load_n(&clusters[i].epoch, __ATOMIC_RELAXED) == epoch;
+		for(int j = 0; j < ENTRIES_PER_CLUSTER && n < 1000; ++j, ++n)
+		{
+			TTEntry entry = clusters[i].entries[j].load();
+			used += current && (entry.gen_and_bound & 3) != TTBound::EMPTY && (entry.gen_and_bound & ~3) == gen;
+		}
+	}
+	return used * 1000 / std::max(n, 1);
 }
+#endif
 
-void clear_TT()
+void TranspositionTable::clear()
 {
-	for(int i = 0; i < TT_CLUSTERS; ++i)
-		for(int j = 0; j < ENTRIES_PER_CLUSTER; ++j)
-			TT[i].entries[j].write(0, Move::NO_MOVE, TT_NO_VALUE, TT_NO_VALUE, 0, 0);
+	//0 is the epoch of freshly mapped clusters
+	if(++epoch == 0)
+		epoch = 1;
+	//Emptied entries have generation 0, so restart from there: the same search then
+	//ages and replaces entries the same way after every clear
+	gen = 0;
 }
+
+#ifdef EVAL_CACHE
+
+//Default size (64KB), used unless one is given at startup (a -e <KB>, 0 to disable)
+#ifndef EVAL_CACHE_ENTRIES
+#define EVAL_CACHE_ENTRIES 8192
+#endif
+
+//Static evals by position, for the nodes that miss the TT (mostly qsearch, which only
+//writes the TT on a stand-pat cutoff). Direct-mapped and shared by an engine's threads:
+//each entry is one relaxed 64-bit word, the hash with its low 16 bits replaced by the
+//eval, so a reader never sees a torn entry. An eval only depends on the position, so the
+//cache is never cleared.
+struct EvalCache
+{
+	uint64_t* entries = nullptr;
+	uint64_t n_entries = 0;  //0 = disabled
+	uint64_t bytes = 0;
+	
+	void init(uint64_t entries_);
+	
+	uint64_t& slot(uint64_t hash)
+	{
+		return entries[(static_cast<unsigned __int128>(n_entries) * static_cast<unsigned __int128>(hash)) >> 64];
+	}
+	
+	bool probe(uint64_t hash, Value& value)
+	{
+		if(n_entries == 0)
+			return false;
+		uint64_t entry = __atomic_load_n(&slot(hash), __ATOMIC_RELAXED);
+		if((entry ^ hash) >> 16)
+			return false;
+		value = static_cast<Value>(entry);
+		return true;
+	}
+	
+	void store(uint64_t hash, Value value)
+	{
+		if(n_entries)
+			__atomic_store_n(&slot(hash), (hash & ~0xFFFFull) | static_cast<uint16_t>(value), __ATOMIC_RELAXED);
+	}
+};
+
+void EvalCache::init(uint64_t entries_)
+{
+	if(entries)
+		munmap(entries, bytes);
+	entries = nullptr;
+	n_entries = entries_;
+	bytes = entries_ * sizeof(uint64_t);
+	if(entries_ == 0)
+		return;
+	
+	void* mem = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if(mem == MAP_FAILED)
+	{
+		print_err("Eval cache allocation failed\n", 29);
+		exit(-1);
+	}
+	entries = reinterpret_cast<uint64_t*>(mem);
+}
+
+#endif
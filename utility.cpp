@@ -34,4 +34,110 @@ static void print_num(uint64_t number)
     }
     if(!started)
         print(digits, 1);
-}
\ No newline at end of file
+}
+
+#if defined(SMP) || defined(TT_RESIZE) || defined(EVAL_CACHE) || defined(UCI)
+static int parse_num(const char * str)
+{
+	int number = 0;
+	for(; *str >= '0' && *str <= '9'; ++str)
+		number = number * 10 + (*str - '0');
+	return number;
+}
+#endif
+
+//Input read from stdin but not yet used. The input thread in main.cpp fills it and does the
+//locking. The buffer grows to hold whatever is waiting, so no input is ever dropped.
+static char* input_buf = nullptr;
+static int input_start = 0, input_end = 0, input_capacity = 0;
+
+//buf resized to size bytes, keeping its contents; exits if there is no memory for it
+static char* resize_buffer(char* buf, int size)
+{
+	buf = static_cast<char*>(realloc(buf, size));
+	if(!buf)
+	{
+		print_err("Input buffer allocation failed\n", 31);
+		exit(-1);
+	}
+	return buf;
+}
+
+static void push_input(const char* str, int bytes)
+{
+	for(int i = input_start; i < input_end; ++i)
+		input_buf[i - input_start] = input_buf[i];
+	input_end -= input_start;
+	input_start = 0;
+	
+	if(input_end + bytes > input_capacity)
+	{
+		input_capacity = std::max(2 * input_capacity, input_end + bytes);
+		input_buf = resize_buffer(input_buf, input_capacity);
+	}
+	for(int i = 0; i < bytes; ++i)
+		input_buf[input_end++] = str[i];
+}
+
+static int input_size()
+{
+	return input_end - input_start;
+}
+
+//Copies up to size - 1 bytes, 0-terminated
+static int take_input(char* buf, int size)
+{
+	int n = 0;
+	while(input_start < input_end && n < size - 1)
+		buf[n++] = input_buf[input_start++];
+	buf[n] = 0;
+	return n;
+}
+
+#ifdef UCI
+//Whether a whole line is waiting
+static bool has_line()
+{
+	for(int i = input_start; i < input_end; ++i)
+		if(input_buf[i] == '\n')
+			return true;
+	return false;
+}
+
+//Moves the next line into line, 0-terminated without its line ending, if a whole line is
+//there. line grows to fit it.
+static bool take_line(char*& line, int& capacity)
+{
+	for(int i = input_start; i < input_end; ++i)
+		if(input_buf[i] == '\n')
+		{
+			int n = i - input_start;
+			if(n >= capacity)
+			{
+				capacity = n + 1;
+				line = resize_buffer(line, capacity);
+			}
+			for(int j = 0; j < n; ++j)
+				line[j] = input_buf[input_start + j];
+			if(n > 0 && line[n - 1] == '\r')
+				n--;
+			line[n] = 0;
+			input_start = i + 1;
+			return true;
+		}
+	return false;
+}
+
+//Takes the next line if it is command
+static bool take_command(const char* command)
+{
+	int length = __builtin_strlen(command);
+	if(!has_line() || input_size() <= length || __builtin_memcmp(input_buf + input_start, command, length) != 0)
+		return false;
+	char end = input_buf[input_start + length];
+	if(end != '\n' && end != '\r' && end != ' ')
+		return false;
+	while(input_buf[input_start++] != '\n');
+	return true;
+}
+#endif
\ No newline at end of file